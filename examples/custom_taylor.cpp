@@ -2,6 +2,9 @@
  * Example demonstrating how to implement a custom taylor serie, 
  * here function is f(x) = exp(exp(x) - 1) for which we know the development : 
  * f(x) = sum{B_n / n! x^n} where B_n is the nth Bell number
+ *
+ * The same series can be obtained without knowing its coefficients,
+ * by composing truncated power series at compile time
  */
 #include <cmath>
 #include <iostream>
@@ -17,8 +20,13 @@ struct my_coeff {
 template<size_t deg>
 using F = aerobus::taylor<aerobus::i64, my_coeff, deg>;
 
+using S = aerobus::power_series<aerobus::i64, 15>;
+using E = S::from_taylor_t<aerobus::internal::exp_coeff>;
+using G = S::compose_t<E, S::sub_t<E, S::one>>;
+
 int main() {
     constexpr double x = F<15>::eval(0.1);
+    constexpr double y = G::eval(0.1);
     double xx = std::exp(std::exp(0.1) - 1);
-    std::cout << std::setprecision(18) << x << " == " << xx << std::endl;
+    std::cout << std::setprecision(18) << x << " == " << y << " == " << xx << std::endl;
 }
@@ -15,8 +15,11 @@
 #include <cmath>
 #include <limits>
 #include <cfenv>
-#ifdef WITH_CUDA_FP16
 #include <bit>
+#if (defined(__AVX2__) || defined(__AVX512F__)) && !defined(__CUDACC__) && !defined(__HIPCC__)
+#include <immintrin.h>
+#endif
+#ifdef WITH_CUDA_FP16
 #include <cuda_fp16.h>
 #endif
 
@@ -37,6 +40,17 @@
 #define DEVICE
 #endif
 
+// makes x opaque to reassociation of floating point operations (-ffast-math, -fassociative-math),
+// which would otherwise simplify (a + b) - a to b and error free transformations to zero
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_assoc_barrier)
+#define ASSOC_BARRIER(x) __builtin_assoc_barrier(x)
+#endif
+#endif
+#ifndef ASSOC_BARRIER
+#define ASSOC_BARRIER(x) (x)
+#endif
+
 //! \namespace aerobus main namespace for all publicly exposed types or functions
 
 //! \namespace aerobus::known_polynomials families of well known polynomials such as Hermite or Bernstein
@@ -322,7 +336,7 @@ namespace aerobus {
 
 // arithmetic helpers
 namespace aerobus {
-    struct double_double {};
+    struct double_double;
 
     template<typename T>
     struct arithmetic_helpers;
@@ -472,7 +486,7 @@ namespace aerobus {
         struct FloatLayout<float> {
             static constexpr uint8_t exponent = 8;
             static constexpr uint8_t mantissa = 23;
-            static constexpr uint8_t r = 11;  // ceil(mantissa/2)
+            static constexpr uint8_t r = 12;  // ceil((mantissa + 1)/2), Dekker split needs half of the 24 bits
             static constexpr float shift = (1 << r) + 1;
         };
 
@@ -493,8 +507,8 @@ namespace aerobus {
         template<typename T>
         struct Split {
             static constexpr INLINED DEVICE void func(T a, T *x, T *y)  {
-                T z = a * FloatLayout<T>::shift;
-                *x = z - (z - a);
+                T z = ASSOC_BARRIER(a * FloatLayout<T>::shift);
+                *x = ASSOC_BARRIER(z - ASSOC_BARRIER(z - a));
                 *y = a - *x;
             }
         };
@@ -519,196 +533,1454 @@ namespace aerobus {
         };
         #endif
 
+        /// @brief error free sum (Knuth) : x = fl(a + b) and a + b = x + y exactly
         template<typename T>
         static constexpr INLINED DEVICE void two_sum(T a, T b, T *x, T *y) {
-            *x = a + b;
-            T z = *x - a;
-            *y = (a - (*x - z)) + (b - z);
+            *x = ASSOC_BARRIER(a + b);
+            T z = ASSOC_BARRIER(*x - a);
+            *y = ASSOC_BARRIER(a - ASSOC_BARRIER(*x - z)) + ASSOC_BARRIER(b - z);
         }
 
+        /// @brief error free product : x = fl(a * b) and a * b = x + y exactly
+        ///
+        /// with a hardware fma, y = fma(a, b, -x) : two instructions, and nothing left for the compiler to contract.
+        /// Dekker's splitting otherwise, and in constant evaluation, where no contraction happens
+        /// (gcc contracts a * b + c into fma whenever the target has one, which breaks splitting)
         template<typename T>
         static constexpr INLINED DEVICE void two_prod(T a, T b, T *x, T *y) {
             *x = a * b;
-            #ifdef __clang__
-            *y = fma_helper<T>::eval(a, b, -*x);
-            #else
+            #if (defined(__FMA__) || defined(__FP_FAST_FMA)) && !defined(__CUDA_ARCH__)
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+                if (!std::is_constant_evaluated()) {
+                    *y = std::fma(a, b, -*x);
+                    return;
+                }
+            }
+            #endif
             T ah, al, bh, bl;
             Split<T>::func(a, &ah, &al);
             Split<T>::func(b, &bh, &bl);
-            *y = al * bl - (((*x - ah * bh) - al * bh) - ah * bl);
-            #endif
-        }
-
-        template<typename T, size_t N>
-        static INLINED DEVICE T horner(T *p1, T *p2, T x) {
-            T r = p1[0] + p2[0];
-            for (int64_t i = N - 1; i >= 0; --i) {
-                r = r * x + p1[N - i] + p2[N - i];
-            }
-
-            return r;
+            *y = al * bl - ASSOC_BARRIER(ASSOC_BARRIER(ASSOC_BARRIER(*x - ah * bh) - al * bh) - ah * bl);
         }
     }  // namespace internal
 }  // namespace aerobus
 
-// type utilities
+// double-double arithmetic
 namespace aerobus {
-    namespace internal {
-        template<template<typename...> typename TT, typename T>
-        struct is_instantiation_of : std::false_type { };
+    /**
+     * unevaluated sum of two doubles (hi + lo, with |lo| <= ulp(hi) / 2), giving about 106 bits of mantissa
+     *
+     * arithmetic relies on error free transformations (two_sum, two_prod),
+     * which are protected against reassociation (-ffast-math) where the compiler has __builtin_assoc_barrier
+     */
+    struct double_double {
+        /// @brief leading part
+        double hi;
+        /// @brief trailing part
+        double lo;
+
+        constexpr DEVICE double_double() : hi(0.0), lo(0.0) {}
+        // NOLINTNEXTLINE(runtime/explicit)
+        constexpr DEVICE double_double(const double x) : hi(x), lo(0.0) {}
+        constexpr DEVICE double_double(const double h, const double l) : hi(h), lo(l) {}
+
+        /// @brief rounds to nearest double
+        explicit constexpr DEVICE operator double() const {
+            return hi + lo;
+        }
 
-        template<template<typename...> typename TT, typename... Ts>
-        struct is_instantiation_of<TT, TT<Ts...>> : std::true_type { };
+     private:
+        // |a| >= |b| is required
+        static constexpr INLINED DEVICE double_double quick_two_sum(const double a, const double b) {
+            double s = ASSOC_BARRIER(a + b);
+            return double_double(s, b - ASSOC_BARRIER(s - a));
+        }
 
-        template<template<typename...> typename TT, typename T>
-        inline constexpr bool is_instantiation_of_v = is_instantiation_of<TT, T>::value;
+        static constexpr INLINED DEVICE double_double two_sum(const double a, const double b) {
+            double s = 0, e = 0;
+            internal::two_sum<double>(a, b, &s, &e);
+            return double_double(s, e);
+        }
 
-        template <int64_t i, typename T, typename... Ts>
-        struct type_at {
-            static_assert(i < sizeof...(Ts) + 1, "index out of range");
-            using type = typename type_at<i - 1, Ts...>::type;
-        };
+        static constexpr INLINED DEVICE double_double two_prod(const double a, const double b) {
+            double p = 0, e = 0;
+            internal::two_prod<double>(a, b, &p, &e);
+            return double_double(p, e);
+        }
 
-        template <typename T, typename... Ts> struct type_at<0, T, Ts...> {
-            using type = T;
-        };
+     public:
+        constexpr DEVICE double_double operator-() const {
+            return double_double(-hi, -lo);
+        }
 
-        template <size_t i, typename... Ts>
-        using type_at_t = typename type_at<i, Ts...>::type;
+        friend constexpr DEVICE double_double operator+(const double_double& a, const double_double& b) {
+            double_double s = two_sum(a.hi, b.hi);
+            double_double t = two_sum(a.lo, b.lo);
+            s.lo += t.hi;
+            s = quick_two_sum(s.hi, s.lo);
+            s.lo += t.lo;
+            return quick_two_sum(s.hi, s.lo);
+        }
 
+        friend constexpr DEVICE double_double operator-(const double_double& a, const double_double& b) {
+            return a + (-b);
+        }
 
-        template<size_t n, size_t i, typename E = void>
-        struct _is_prime {};
+        friend constexpr DEVICE double_double operator*(const double_double& a, const double_double& b) {
+            double_double p = two_prod(a.hi, b.hi);
+            p.lo += a.hi * b.lo + a.lo * b.hi;
+            return quick_two_sum(p.hi, p.lo);
+        }
 
-        template<size_t i>
-        struct _is_prime<0, i> {
-            static constexpr bool value = false;
+        friend constexpr DEVICE double_double operator/(const double_double& a, const double_double& b) {
+            double q1 = a.hi / b.hi;
+            double_double r = a - b * double_double(q1);
+            double q2 = r.hi / b.hi;
+            r = r - b * double_double(q2);
+            double q3 = r.hi / b.hi;
+            return quick_two_sum(q1, q2) + double_double(q3);
+        }
+
+        friend constexpr DEVICE bool operator==(const double_double& a, const double_double& b) {
+            return a.hi == b.hi && a.lo == b.lo;
+        }
+
+        friend constexpr DEVICE bool operator!=(const double_double& a, const double_double& b) {
+            return !(a == b);
+        }
+
+        friend constexpr DEVICE bool operator<(const double_double& a, const double_double& b) {
+            return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+        }
+
+        friend constexpr DEVICE bool operator>(const double_double& a, const double_double& b) {
+            return b < a;
+        }
+
+        friend constexpr DEVICE bool operator<=(const double_double& a, const double_double& b) {
+            return !(b < a);
+        }
+
+        friend constexpr DEVICE bool operator>=(const double_double& a, const double_double& b) {
+            return !(a < b);
+        }
+    };
+
+    template<>
+    struct arithmetic_helpers<double_double> {
+        using integers = int64_t;
+        using upper_type = double_double;
+        static INLINED DEVICE consteval double_double one() { return double_double(1.0); }
+        static INLINED DEVICE consteval double_double zero() { return double_double(0.0); }
+        static INLINED DEVICE consteval double_double m_zero() { return double_double(-0.0); }
+        static INLINED DEVICE consteval double_double pi() {
+            return double_double(0x1.921fb54442d18p1, 0x1.1a62633145c07p-53);
+        }
+        static INLINED DEVICE consteval double_double pi_2() {
+            return double_double(0x1.921fb54442d18p0, 0x1.1a62633145c07p-54);
+        }
+        static INLINED DEVICE consteval double_double pi_4() {
+            return double_double(0x1.921fb54442d18p-1, 0x1.1a62633145c07p-55);
+        }
+        static INLINED DEVICE consteval double_double two_pi() {
+            return double_double(0x1.921fb54442d18p2, 0x1.1a62633145c07p-52);
+        }
+        static INLINED DEVICE consteval double_double inv_two_pi() {
+            return double_double(0x1.45f306dc9c883p-3, -0x1.6b01ec5417056p-57);
+        }
+        static INLINED DEVICE consteval double_double half() { return double_double(0x1p-1); }
+        static INLINED DEVICE bool is_inf(const double_double& x) {
+            return std::isinf(x.hi);
+        }
+    };
+
+    template<>
+    struct meta_libm<double_double> {
+        static INLINED DEVICE double_double floor(const double_double& f) {
+            double hi = std::floor(f.hi);
+            if (hi != f.hi) {
+                return double_double(hi);
+            }
+            // hi is an integer, fractional part lives in lo
+            double lo = std::floor(f.lo);
+            double s = hi + lo;
+            return double_double(s, lo - (s - hi));
+        }
+
+        // same semantic as std::fmod : result has the sign of x
+        static INLINED DEVICE double_double fmod(const double_double& x, const double_double& d) {
+            double_double q = x / d;
+            double_double n = q.hi >= 0 ? floor(q) : -floor(-q);
+            return x - d * n;
+        }
+    };
+
+    namespace internal {
+        template<>
+        struct fma_helper<double_double> {
+            static constexpr INLINED DEVICE double_double eval(
+                const double_double& x, const double_double& y, const double_double& z) {
+                return x * y + z;
+            }
         };
 
-        template<size_t i>
-        struct _is_prime<1, i> {
-            static constexpr bool value = false;
+        template<>
+        struct staticcast<double_double, double> {
+            template<auto x>
+            static constexpr INLINED DEVICE double_double func() {
+                return double_double(static_cast<double>(x));
+            }
+
+            static INLINED DEVICE double_double eval(const double& x) {
+                return double_double(x);
+            }
         };
 
-        template<size_t i>
-        struct _is_prime<2, i> {
-            static constexpr bool value = true;
+        template<>
+        struct staticcast<double, double_double> {
+            static INLINED DEVICE double eval(const double_double& x) {
+                return static_cast<double>(x);
+            }
         };
+    }  // namespace internal
+}  // namespace aerobus
 
-        template<size_t i>
-        struct _is_prime<3, i> {
-            static constexpr bool value = true;
+// simd lanes and batched evaluation
+namespace aerobus {
+    namespace internal {
+        /// @brief one element at a time -- used as fallback, and for heads and tails of batched evaluations
+        /// @tparam T arithmetic type
+        template<typename T>
+        struct scalar_lane {
+            using scalar = T;
+            using type = T;
+            static constexpr size_t width = 1;
+            static constexpr size_t alignment = alignof(T);
+
+            static INLINED type load(const T* p) { return *p; }
+            static INLINED type loadu(const T* p) { return *p; }
+            static INLINED void store(T* p, const type x) { *p = x; }
+            static INLINED void storeu(T* p, const type x) { *p = x; }
+            static INLINED type broadcast(const T x) { return x; }
+            static INLINED type add(const type x, const type y) { return x + y; }
+            static INLINED type sub(const type x, const type y) { return x - y; }
+            static INLINED type mul(const type x, const type y) { return x * y; }
+            // x * y + z
+            static INLINED type fma(const type x, const type y, const type z) {
+                return fma_helper<T>::eval(x, y, z);
+            }
+            static INLINED type barrier(const type x) { return ASSOC_BARRIER(x); }
+            static INLINED void two_sum(const type a, const type b, type *x, type *y) {
+                internal::two_sum<T>(a, b, x, y);
+            }
+            static INLINED void two_prod(const type a, const type b, type *x, type *y) {
+                internal::two_prod<T>(a, b, x, y);
+            }
+            // z - x * y
+            static INLINED type fnma(const type x, const type y, const type z) { return z - x * y; }
+            // round to nearest integer, ties to even
+            static INLINED type round(const type x) { return std::nearbyint(x); }
+            static INLINED type floor(const type x) { return std::floor(x); }
+            static INLINED type abs(const type x) { return std::fabs(x); }
+            static INLINED type div(const type x, const type y) { return x / y; }
+            static INLINED type sqrt(const type x) { return std::sqrt(x); }
+            // same semantic as x86 : second operand is returned if any is NaN
+            static INLINED type min(const type x, const type y) { return x < y ? x : y; }
+            static INLINED type max(const type x, const type y) { return x > y ? x : y; }
+
+            // comparisons and selection
+            using mask = bool;
+            static INLINED mask gt(const type x, const type y) { return x > y; }
+            static INLINED mask lt(const type x, const type y) { return x < y; }
+            static INLINED mask eq(const type x, const type y) { return x == y; }
+            static INLINED bool any(const mask m) { return m; }
+            // m ? x : y
+            static INLINED type select(const mask m, const type x, const type y) { return m ? x : y; }
+
+            // bitwise operations on the representation of T
+            using ibits = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+            using itype = ibits;
+            static INLINED itype as_bits(const type x) { return std::bit_cast<itype>(x); }
+            static INLINED type from_bits(const itype x) { return std::bit_cast<type>(x); }
+            static INLINED itype ibroadcast(const ibits x) { return x; }
+            static INLINED itype iand(const itype x, const itype y) { return x & y; }
+            static INLINED itype ixor(const itype x, const itype y) { return x ^ y; }
+            static INLINED itype iadd(const itype x, const itype y) { return x + y; }
+            template<int n>
+            static INLINED itype shl(const itype x) { return x << n; }
+            // logical shift
+            template<int n>
+            static INLINED itype shr(const itype x) { return x >> n; }
+            static INLINED mask ieq(const itype x, const itype y) { return x == y; }
+        };
+
+        #if (defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))) \
+            && !defined(__CUDACC__) && !defined(__HIPCC__)
+        /// @brief operations shared by all vector lanes : error free transformations
+        /// @tparam Lane a vector lane, must provide add, sub, mul and fms
+        template<typename Lane>
+        struct vector_lane_eft {
+            /// @brief ASSOC_BARRIER for vector registers
+            /// gcc 12 lowers __builtin_assoc_barrier on __m512 lane by lane (extract / insert)
+            /// an empty asm statement pins the value in its register at no cost
+            template<typename type>
+            static INLINED type barrier(type x) {
+                #if defined(__GNUC__)
+                __asm__("" : "+v"(x));  // NOLINT
+                return x;
+                #else
+                return ASSOC_BARRIER(x);
+                #endif
+            }
+            template<typename type>
+            static INLINED void two_sum(const type a, const type b, type *x, type *y) {
+                *x = ASSOC_BARRIER(Lane::add(a, b));
+                type z = ASSOC_BARRIER(Lane::sub(*x, a));
+                *y = Lane::add(
+                    ASSOC_BARRIER(Lane::sub(a, ASSOC_BARRIER(Lane::sub(*x, z)))),
+                    ASSOC_BARRIER(Lane::sub(b, z)));
+            }
+            // vector lanes always have a hardware fma, making two_prod exact in two instructions
+            template<typename type>
+            static INLINED void two_prod(const type a, const type b, type *x, type *y) {
+                *x = Lane::mul(a, b);
+                *y = Lane::fms(a, b, *x);
+            }
         };
+        #endif
 
-        template<size_t i>
-        struct _is_prime<5, i> {
-            static constexpr bool value = true;
+        #if defined(__AVX2__) && defined(__FMA__) && !defined(__CUDACC__) && !defined(__HIPCC__)
+        template<typename T>
+        struct avx2_lane;
+
+        template<>
+        struct avx2_lane<double> : vector_lane_eft<avx2_lane<double>> {
+            using scalar = double;
+            using type = __m256d;
+            static constexpr size_t width = 4;
+            static constexpr size_t alignment = 32;
+
+            static INLINED type load(const double* p) { return _mm256_load_pd(p); }
+            static INLINED type loadu(const double* p) { return _mm256_loadu_pd(p); }
+            static INLINED void store(double* p, const type x) { _mm256_store_pd(p, x); }
+            static INLINED void storeu(double* p, const type x) { _mm256_storeu_pd(p, x); }
+            static INLINED type broadcast(const double x) { return _mm256_set1_pd(x); }
+            static INLINED type add(const type x, const type y) { return _mm256_add_pd(x, y); }
+            static INLINED type sub(const type x, const type y) { return _mm256_sub_pd(x, y); }
+            static INLINED type mul(const type x, const type y) { return _mm256_mul_pd(x, y); }
+            static INLINED type fma(const type x, const type y, const type z) { return _mm256_fmadd_pd(x, y, z); }
+            // x * y - z
+            static INLINED type fms(const type x, const type y, const type z) { return _mm256_fmsub_pd(x, y, z); }
+            static INLINED type fnma(const type x, const type y, const type z) { return _mm256_fnmadd_pd(x, y, z); }
+            static INLINED type round(const type x) {
+                return _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+            static INLINED type floor(const type x) { return _mm256_floor_pd(x); }
+            static INLINED type abs(const type x) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+            static INLINED type div(const type x, const type y) { return _mm256_div_pd(x, y); }
+            static INLINED type sqrt(const type x) { return _mm256_sqrt_pd(x); }
+            static INLINED type min(const type x, const type y) { return _mm256_min_pd(x, y); }
+            static INLINED type max(const type x, const type y) { return _mm256_max_pd(x, y); }
+
+            using mask = __m256d;
+            static INLINED mask gt(const type x, const type y) { return _mm256_cmp_pd(x, y, _CMP_GT_OQ); }
+            static INLINED mask lt(const type x, const type y) { return _mm256_cmp_pd(x, y, _CMP_LT_OQ); }
+            static INLINED mask eq(const type x, const type y) { return _mm256_cmp_pd(x, y, _CMP_EQ_OQ); }
+            static INLINED bool any(const mask m) { return _mm256_movemask_pd(m) != 0; }
+            static INLINED type select(const mask m, const type x, const type y) { return _mm256_blendv_pd(y, x, m); }
+
+            using ibits = uint64_t;
+            using itype = __m256i;
+            static INLINED itype as_bits(const type x) { return _mm256_castpd_si256(x); }
+            static INLINED type from_bits(const itype x) { return _mm256_castsi256_pd(x); }
+            static INLINED itype ibroadcast(const ibits x) { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+            static INLINED itype iand(const itype x, const itype y) { return _mm256_and_si256(x, y); }
+            static INLINED itype ixor(const itype x, const itype y) { return _mm256_xor_si256(x, y); }
+            static INLINED itype iadd(const itype x, const itype y) { return _mm256_add_epi64(x, y); }
+            template<int n>
+            static INLINED itype shl(const itype x) { return _mm256_slli_epi64(x, n); }
+            template<int n>
+            static INLINED itype shr(const itype x) { return _mm256_srli_epi64(x, n); }
+            static INLINED mask ieq(const itype x, const itype y) {
+                return _mm256_castsi256_pd(_mm256_cmpeq_epi64(x, y));
+            }
         };
 
-        template<size_t i>
-        struct _is_prime<7, i> {
-            static constexpr bool value = true;
+        template<>
+        struct avx2_lane<float> : vector_lane_eft<avx2_lane<float>> {
+            using scalar = float;
+            using type = __m256;
+            static constexpr size_t width = 8;
+            static constexpr size_t alignment = 32;
+
+            static INLINED type load(const float* p) { return _mm256_load_ps(p); }
+            static INLINED type loadu(const float* p) { return _mm256_loadu_ps(p); }
+            static INLINED void store(float* p, const type x) { _mm256_store_ps(p, x); }
+            static INLINED void storeu(float* p, const type x) { _mm256_storeu_ps(p, x); }
+            static INLINED type broadcast(const float x) { return _mm256_set1_ps(x); }
+            static INLINED type add(const type x, const type y) { return _mm256_add_ps(x, y); }
+            static INLINED type sub(const type x, const type y) { return _mm256_sub_ps(x, y); }
+            static INLINED type mul(const type x, const type y) { return _mm256_mul_ps(x, y); }
+            static INLINED type fma(const type x, const type y, const type z) { return _mm256_fmadd_ps(x, y, z); }
+            static INLINED type fms(const type x, const type y, const type z) { return _mm256_fmsub_ps(x, y, z); }
+            static INLINED type fnma(const type x, const type y, const type z) { return _mm256_fnmadd_ps(x, y, z); }
+            static INLINED type round(const type x) {
+                return _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+            static INLINED type floor(const type x) { return _mm256_floor_ps(x); }
+            static INLINED type abs(const type x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0F), x); }
+            static INLINED type div(const type x, const type y) { return _mm256_div_ps(x, y); }
+            static INLINED type sqrt(const type x) { return _mm256_sqrt_ps(x); }
+            static INLINED type min(const type x, const type y) { return _mm256_min_ps(x, y); }
+            static INLINED type max(const type x, const type y) { return _mm256_max_ps(x, y); }
+
+            using mask = __m256;
+            static INLINED mask gt(const type x, const type y) { return _mm256_cmp_ps(x, y, _CMP_GT_OQ); }
+            static INLINED mask lt(const type x, const type y) { return _mm256_cmp_ps(x, y, _CMP_LT_OQ); }
+            static INLINED mask eq(const type x, const type y) { return _mm256_cmp_ps(x, y, _CMP_EQ_OQ); }
+            static INLINED bool any(const mask m) { return _mm256_movemask_ps(m) != 0; }
+            static INLINED type select(const mask m, const type x, const type y) { return _mm256_blendv_ps(y, x, m); }
+
+            using ibits = uint32_t;
+            using itype = __m256i;
+            static INLINED itype as_bits(const type x) { return _mm256_castps_si256(x); }
+            static INLINED type from_bits(const itype x) { return _mm256_castsi256_ps(x); }
+            static INLINED itype ibroadcast(const ibits x) { return _mm256_set1_epi32(static_cast<int>(x)); }
+            static INLINED itype iand(const itype x, const itype y) { return _mm256_and_si256(x, y); }
+            static INLINED itype ixor(const itype x, const itype y) { return _mm256_xor_si256(x, y); }
+            static INLINED itype iadd(const itype x, const itype y) { return _mm256_add_epi32(x, y); }
+            template<int n>
+            static INLINED itype shl(const itype x) { return _mm256_slli_epi32(x, n); }
+            template<int n>
+            static INLINED itype shr(const itype x) { return _mm256_srli_epi32(x, n); }
+            static INLINED mask ieq(const itype x, const itype y) {
+                return _mm256_castsi256_ps(_mm256_cmpeq_epi32(x, y));
+            }
         };
+        #endif
 
-        template<size_t n, size_t i>
-        struct _is_prime<n, i, std::enable_if_t<(n != 2 && n % 2 == 0)>> {
-            static constexpr bool value = false;
+        #if defined(__AVX512F__) && !defined(__CUDACC__) && !defined(__HIPCC__)
+        // unmasked roundscale, sqrt, min, max and shifts are written as their maskz forms under a full mask :
+        // gcc 12 implements the unmasked ones with an _mm512_undefined_* pass-through, which triggers
+        // -Wmaybe-uninitialized once inlined. The full mask compiles to the same unmasked instruction
+        template<typename T>
+        struct avx512_lane;
+
+        template<>
+        struct avx512_lane<double> : vector_lane_eft<avx512_lane<double>> {
+            using scalar = double;
+            using type = __m512d;
+            static constexpr size_t width = 8;
+            static constexpr size_t alignment = 64;
+
+            static INLINED type load(const double* p) { return _mm512_load_pd(p); }
+            static INLINED type loadu(const double* p) { return _mm512_loadu_pd(p); }
+            static INLINED void store(double* p, const type x) { _mm512_store_pd(p, x); }
+            static INLINED void storeu(double* p, const type x) { _mm512_storeu_pd(p, x); }
+            static INLINED type broadcast(const double x) { return _mm512_set1_pd(x); }
+            static INLINED type add(const type x, const type y) { return _mm512_add_pd(x, y); }
+            static INLINED type sub(const type x, const type y) { return _mm512_sub_pd(x, y); }
+            static INLINED type mul(const type x, const type y) { return _mm512_mul_pd(x, y); }
+            static INLINED type fma(const type x, const type y, const type z) { return _mm512_fmadd_pd(x, y, z); }
+            static INLINED type fms(const type x, const type y, const type z) { return _mm512_fmsub_pd(x, y, z); }
+            static INLINED type fnma(const type x, const type y, const type z) { return _mm512_fnmadd_pd(x, y, z); }
+            static INLINED type round(const type x) {
+                return _mm512_maskz_roundscale_pd(full, x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+            static INLINED type floor(const type x) {
+                return _mm512_maskz_roundscale_pd(full, x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            }
+            static INLINED type abs(const type x) { return _mm512_abs_pd(x); }
+            static INLINED type div(const type x, const type y) { return _mm512_div_pd(x, y); }
+            static INLINED type sqrt(const type x) { return _mm512_maskz_sqrt_pd(full, x); }
+            static INLINED type min(const type x, const type y) { return _mm512_maskz_min_pd(full, x, y); }
+            static INLINED type max(const type x, const type y) { return _mm512_maskz_max_pd(full, x, y); }
+
+            using mask = __mmask8;
+            static constexpr mask full = 0xFF;
+            static INLINED mask gt(const type x, const type y) { return _mm512_cmp_pd_mask(x, y, _CMP_GT_OQ); }
+            static INLINED mask lt(const type x, const type y) { return _mm512_cmp_pd_mask(x, y, _CMP_LT_OQ); }
+            static INLINED mask eq(const type x, const type y) { return _mm512_cmp_pd_mask(x, y, _CMP_EQ_OQ); }
+            static INLINED bool any(const mask m) { return m != 0; }
+            static INLINED type select(const mask m, const type x, const type y) {
+                return _mm512_mask_blend_pd(m, y, x);
+            }
+
+            using ibits = uint64_t;
+            using itype = __m512i;
+            static INLINED itype as_bits(const type x) { return _mm512_castpd_si512(x); }
+            static INLINED type from_bits(const itype x) { return _mm512_castsi512_pd(x); }
+            static INLINED itype ibroadcast(const ibits x) { return _mm512_set1_epi64(static_cast<long long>(x)); }
+            static INLINED itype iand(const itype x, const itype y) { return _mm512_and_si512(x, y); }
+            static INLINED itype ixor(const itype x, const itype y) { return _mm512_xor_si512(x, y); }
+            static INLINED itype iadd(const itype x, const itype y) { return _mm512_add_epi64(x, y); }
+            template<int n>
+            static INLINED itype shl(const itype x) { return _mm512_maskz_slli_epi64(full, x, n); }
+            template<int n>
+            static INLINED itype shr(const itype x) { return _mm512_maskz_srli_epi64(full, x, n); }
+            static INLINED mask ieq(const itype x, const itype y) { return _mm512_cmpeq_epi64_mask(x, y); }
         };
 
-        template<size_t n, size_t i>
-        struct _is_prime<n, i, std::enable_if_t<(n != 2 && n != 3 && n % 2 != 0 && n % 3 == 0)>> {
-            static constexpr bool value = false;
+        template<>
+        struct avx512_lane<float> : vector_lane_eft<avx512_lane<float>> {
+            using scalar = float;
+            using type = __m512;
+            static constexpr size_t width = 16;
+            static constexpr size_t alignment = 64;
+
+            static INLINED type load(const float* p) { return _mm512_load_ps(p); }
+            static INLINED type loadu(const float* p) { return _mm512_loadu_ps(p); }
+            static INLINED void store(float* p, const type x) { _mm512_store_ps(p, x); }
+            static INLINED void storeu(float* p, const type x) { _mm512_storeu_ps(p, x); }
+            static INLINED type broadcast(const float x) { return _mm512_set1_ps(x); }
+            static INLINED type add(const type x, const type y) { return _mm512_add_ps(x, y); }
+            static INLINED type sub(const type x, const type y) { return _mm512_sub_ps(x, y); }
+            static INLINED type mul(const type x, const type y) { return _mm512_mul_ps(x, y); }
+            static INLINED type fma(const type x, const type y, const type z) { return _mm512_fmadd_ps(x, y, z); }
+            static INLINED type fms(const type x, const type y, const type z) { return _mm512_fmsub_ps(x, y, z); }
+            static INLINED type fnma(const type x, const type y, const type z) { return _mm512_fnmadd_ps(x, y, z); }
+            static INLINED type round(const type x) {
+                return _mm512_maskz_roundscale_ps(full, x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            }
+            static INLINED type floor(const type x) {
+                return _mm512_maskz_roundscale_ps(full, x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            }
+            static INLINED type abs(const type x) { return _mm512_abs_ps(x); }
+            static INLINED type div(const type x, const type y) { return _mm512_div_ps(x, y); }
+            static INLINED type sqrt(const type x) { return _mm512_maskz_sqrt_ps(full, x); }
+            static INLINED type min(const type x, const type y) { return _mm512_maskz_min_ps(full, x, y); }
+            static INLINED type max(const type x, const type y) { return _mm512_maskz_max_ps(full, x, y); }
+
+            using mask = __mmask16;
+            static constexpr mask full = 0xFFFF;
+            static INLINED mask gt(const type x, const type y) { return _mm512_cmp_ps_mask(x, y, _CMP_GT_OQ); }
+            static INLINED mask lt(const type x, const type y) { return _mm512_cmp_ps_mask(x, y, _CMP_LT_OQ); }
+            static INLINED mask eq(const type x, const type y) { return _mm512_cmp_ps_mask(x, y, _CMP_EQ_OQ); }
+            static INLINED bool any(const mask m) { return m != 0; }
+            static INLINED type select(const mask m, const type x, const type y) {
+                return _mm512_mask_blend_ps(m, y, x);
+            }
+
+            using ibits = uint32_t;
+            using itype = __m512i;
+            static INLINED itype as_bits(const type x) { return _mm512_castps_si512(x); }
+            static INLINED type from_bits(const itype x) { return _mm512_castsi512_ps(x); }
+            static INLINED itype ibroadcast(const ibits x) { return _mm512_set1_epi32(static_cast<int>(x)); }
+            static INLINED itype iand(const itype x, const itype y) { return _mm512_and_si512(x, y); }
+            static INLINED itype ixor(const itype x, const itype y) { return _mm512_xor_si512(x, y); }
+            static INLINED itype iadd(const itype x, const itype y) { return _mm512_add_epi32(x, y); }
+            template<int n>
+            static INLINED itype shl(const itype x) { return _mm512_maskz_slli_epi32(full, x, n); }
+            template<int n>
+            static INLINED itype shr(const itype x) { return _mm512_maskz_srli_epi32(full, x, n); }
+            static INLINED mask ieq(const itype x, const itype y) { return _mm512_cmpeq_epi32_mask(x, y); }
         };
+        #endif
 
-        template<size_t n, size_t i>
-        struct _is_prime<n, i, std::enable_if_t<(n >= 9 && i * i > n)>> {
-            static constexpr bool value = true;
+        /// @brief widest lane available for T on target architecture (scalar_lane if none)
+        /// @tparam T arithmetic type
+        template<typename T>
+        struct best_lane {
+            using type = scalar_lane<T>;
         };
 
-        template<size_t n, size_t i>
-        struct _is_prime<n, i, std::enable_if_t<(
-            n % i == 0 &&
-            n >= 9 &&
-            n % 3 != 0 &&
-            n % 2 != 0 &&
-            i * i > n)>> {
-            static constexpr bool value = true;
+        #if defined(__AVX512F__) && !defined(__CUDACC__) && !defined(__HIPCC__)
+        template<>
+        struct best_lane<double> {
+            using type = avx512_lane<double>;
         };
 
-        template<size_t n, size_t i>
-        struct _is_prime<n, i, std::enable_if_t<(
-            n % (i+2) == 0 &&
-            n >= 9 &&
-            n % 3 != 0 &&
-            n % 2 != 0 &&
-            i * i <= n)>> {
-            static constexpr bool value = true;
+        template<>
+        struct best_lane<float> {
+            using type = avx512_lane<float>;
+        };
+        #elif defined(__AVX2__) && defined(__FMA__) && !defined(__CUDACC__) && !defined(__HIPCC__)
+        template<>
+        struct best_lane<double> {
+            using type = avx2_lane<double>;
         };
 
-        template<size_t n, size_t i>
-        struct _is_prime<n, i, std::enable_if_t<(
-                n % (i+2) != 0 &&
-                n % i != 0 &&
-                n >= 9 &&
-                n % 3 != 0 &&
-                n % 2 != 0 &&
-                (i * i <= n))>> {
-            static constexpr bool value = _is_prime<n, i+6>::value;
+        template<>
+        struct best_lane<float> {
+            using type = avx2_lane<float>;
         };
-    }  // namespace internal
+        #endif
 
-    /// @brief checks if n is prime
-    /// @tparam n
-    template<size_t n>
-    struct is_prime {
-        /// @brief true iff n is prime
-        static constexpr bool value = internal::_is_prime<n, 5>::value;
-    };
+        template<typename T>
+        using best_lane_t = typename best_lane<T>::type;
+
+        /// @brief coefficients of P converted to T, lowest degree first
+        /// @tparam P polynomial (anything exposing coeff_at_t)
+        /// @tparam T arithmetic type
+        template<typename P, typename T, size_t... I>
+        static constexpr std::array<T, sizeof...(I)> make_coefficients(std::index_sequence<I...>) {
+            return {P::template coeff_at_t<I>::template get<T>()...};
+        }
 
-    /// @brief checks if n is prime
-    /// true if and only if is n is prime
-    /// @tparam n
-    template<size_t n>
-    static constexpr bool is_prime_v = is_prime<n>::value;
+        /// @brief parity of a polynomial, detected at compile time from its coefficients
+        ///
+        /// even (all odd coefficients are zero) : P(x) = Q(x^2), odd (all even coefficients are zero) : P(x) = x Q(x^2)
+        /// where Q (half_t) has half the degree : horner on Q needs half the fma of horner on P
+        /// @tparam P polynomial (anything exposing degree, coeff_at_t and enclosing_type)
+        template<typename P>
+        struct parity_fold {
+         private:
+            template<size_t parity, size_t... I>
+            static constexpr bool all_zero(std::index_sequence<I...>) {
+                return (P::template coeff_at_t<2 * I + parity>::is_zero_t::value && ...);
+            }
 
-    // gcd
-    namespace internal {
-        template <std::size_t... Is>
-        constexpr auto index_sequence_reverse(std::index_sequence<Is...> const&)
-            -> decltype(std::index_sequence<sizeof...(Is) - 1U - Is...>{});
+            // coefficients a_(2i + parity), highest first
+            template<size_t parity, size_t... I>
+            static auto half(std::index_sequence<I...>) -> typename P::enclosing_type::template val<
+                typename P::template coeff_at_t<2 * (sizeof...(I) - 1 - I) + parity>...>;
 
-        template <std::size_t N>
-        using make_index_sequence_reverse
-            = decltype(index_sequence_reverse(std::make_index_sequence<N>{}));
+         public:
+            static constexpr bool is_even = all_zero<1>(std::make_index_sequence<(P::degree + 1) / 2>());
+            static constexpr bool is_odd = !is_even && all_zero<0>(std::make_index_sequence<P::degree / 2 + 1>());
+            /// @brief true when folding saves operations
+            static constexpr bool value = P::degree >= 2 && (is_even || is_odd);
+            static constexpr size_t parity = is_odd ? 1 : 0;
+            /// @brief Q such that P(x) = x^parity Q(x^2)
+            using half_t = decltype(half<parity>(std::make_index_sequence<(P::degree - parity) / 2 + 1>()));
+        };
 
-        /** @brief greatest common divisor
-         * computes the greatest common divisor
-         * exposes it in gcd<A, B>::type
-         * as long as Ring type is an integral domain
-        */
-        template<typename Ring, typename E = void>
-        struct gcd;
+        /// @brief x^n by square and multiply, n known at compile time (n > 0)
+        template<size_t n>
+        struct power_chain {
+            /// @brief number of multiplications
+            static constexpr size_t cost = n == 1 ? 0 : 1 + power_chain<n % 2 == 0 ? n / 2 : n - 1>::cost;
 
-        template<typename Ring>
-        struct gcd<Ring, std::enable_if_t<Ring::is_euclidean_domain>> {
-            template<typename A, typename B, typename E = void>
-            struct gcd_helper {};
+            template<typename T>
+            static constexpr DEVICE INLINED T func(const T& x) {
+                if constexpr (n == 1) {
+                    return x;
+                } else if constexpr (n % 2 == 0) {
+                    const T y = power_chain<n / 2>::func(x);
+                    return y * y;
+                } else {
+                    return x * power_chain<n - 1>::func(x);
+                }
+            }
 
-            // B = 0, A > 0
-            template<typename A, typename B>
-            struct gcd_helper<A, B, std::enable_if_t<
-                ((B::is_zero_t::value) &&
-                    (Ring::template gt_t<A, typename Ring::zero>::value))>> {
-                using type = A;
-            };
+            template<typename Lane>
+            static INLINED typename Lane::type lane(const typename Lane::type x) {
+                if constexpr (n == 1) {
+                    return x;
+                } else if constexpr (n % 2 == 0) {
+                    const typename Lane::type y = power_chain<n / 2>::template lane<Lane>(x);
+                    return Lane::mul(y, y);
+                } else {
+                    return Lane::mul(x, power_chain<n - 1>::template lane<Lane>(x));
+                }
+            }
+        };
 
-            // B = 0, A < 0
-            template<typename A, typename B>
-            struct gcd_helper<A, B, std::enable_if_t<
-                ((B::is_zero_t::value) &&
-                    !(Ring::template gt_t<A, typename Ring::zero>::value))>> {
-                using type = typename Ring::template sub_t<typename Ring::zero, A>;
-            };
+        template<>
+        struct power_chain<0> {
+            static constexpr size_t cost = 0;
+        };
+
+        /// @brief horner schedule on the nonzero coefficients of a polynomial
+        ///
+        /// with nonzero coefficients at exponents e_0 > e_1 > ... > e_m,
+        /// P(x) = (...(a_e0 x^(e_0 - e_1) + a_e1) x^(e_1 - e_2) + ...) x^e_m : one fma per nonzero coefficient
+        /// plus the powers of x, which are shared between equal gaps (and common squarings by the compiler).
+        /// Used only when cheaper than dense horner (degree fma)
+        /// @tparam P polynomial (anything exposing degree and coeff_at_t)
+        template<typename P>
+        struct sparse_schedule {
+         private:
+            template<size_t... I>
+            static constexpr std::array<bool, sizeof...(I)> nonzero(std::index_sequence<I...>) {
+                return {!P::template coeff_at_t<I>::is_zero_t::value...};
+            }
+
+            static constexpr std::array<bool, P::degree + 1> mask = nonzero(std::make_index_sequence<P::degree + 1>());
+
+            static constexpr size_t count_nonzero() {
+                size_t result = 0;
+                for (size_t i = 0; i <= P::degree; ++i) {
+                    result += mask[i] ? 1 : 0;
+                }
+                return result;
+            }
+
+         public:
+            /// @brief number of nonzero coefficients
+            static constexpr size_t count = count_nonzero();
+
+         private:
+            static constexpr std::array<size_t, count> make_exponents() {
+                std::array<size_t, count> result {};
+                size_t j = 0;
+                for (size_t i = P::degree + 1; i > 0; --i) {
+                    if (mask[i - 1]) {
+                        result[j++] = i - 1;
+                    }
+                }
+                return result;
+            }
+
+         public:
+            /// @brief exponents of nonzero coefficients, highest first
+            static constexpr std::array<size_t, count> exponents = make_exponents();
+
+         private:
+            // multiplications of square and multiply for x^n, without the squarings shared with larger powers
+            static constexpr size_t odd_steps(size_t n) {
+                size_t result = 0;
+                for (; n > 1; n /= 2) {
+                    result += n % 2;
+                }
+                return result;
+            }
+
+            static constexpr size_t squarings(size_t n) {
+                size_t result = 0;
+                for (; n > 1; n /= 2) {
+                    result += 1;
+                }
+                return result;
+            }
+
+            static constexpr size_t make_cost() {
+                if (count == 0) {
+                    return 0;
+                }
+                // gaps between consecutive exponents, then the trailing power x^e_m
+                std::array<size_t, count> gaps {};
+                for (size_t i = 1; i < count; ++i) {
+                    gaps[i - 1] = exponents[i - 1] - exponents[i];
+                }
+                gaps[count - 1] = exponents[count - 1];
+                size_t result = count - 1 + (exponents[count - 1] > 0 ? 1 : 0);
+                size_t max_squarings = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    bool seen = gaps[i] <= 1;
+                    for (size_t j = 0; j < i && !seen; ++j) {
+                        seen = gaps[j] == gaps[i];
+                    }
+                    if (!seen) {
+                        result += odd_steps(gaps[i]);
+                        max_squarings = squarings(gaps[i]) > max_squarings ? squarings(gaps[i]) : max_squarings;
+                    }
+                }
+                return result + max_squarings;
+            }
+
+         public:
+            /// @brief estimated number of multiplications and fma
+            static constexpr size_t cost = make_cost();
+            /// @brief true when sparse evaluation is cheaper than dense horner
+            static constexpr bool value = count > 0 && cost < P::degree;
+        };
+
+        /// @brief number of multiplications and fma spent by P::eval (follows its dispatch)
+        /// @tparam P polynomial
+        template<typename P, typename E = void>
+        struct eval_cost {
+            static constexpr size_t value = sparse_schedule<P>::value ? sparse_schedule<P>::cost : P::degree;
+        };
+
+        template<typename P>
+        struct eval_cost<P, std::enable_if_t<parity_fold<P>::value>> {
+            static constexpr size_t value =
+                1 + parity_fold<P>::parity + eval_cost<typename parity_fold<P>::half_t>::value;
+        };
+
+        /// @brief cost model of folding P(Q(x)) into a single polynomial
+        ///
+        /// the composition is not computed : its cost is estimated from its degree and parity (dense horner
+        /// in x or x^2), and compared to the nested evaluation. Folding pays off for affine or tiny Q,
+        /// never for chains of large polynomials (degrees multiply)
+        /// @tparam P outer polynomial
+        /// @tparam Q inner polynomial
+        template<typename P, typename Q>
+        struct fold_cost {
+            static constexpr size_t degree = P::degree * Q::degree;
+            static constexpr bool is_odd = parity_fold<Q>::is_odd && parity_fold<P>::is_odd;
+            static constexpr bool is_even =
+                parity_fold<Q>::is_even || (parity_fold<Q>::is_odd && parity_fold<P>::is_even);
+            /// @brief estimated cost of the folded polynomial
+            static constexpr size_t folded = degree >= 2 && (is_even || is_odd) ?
+                1 + is_odd + (degree - is_odd) / 2 : degree;
+            /// @brief cost of P::eval(Q::eval(x))
+            static constexpr size_t nested = eval_cost<P>::value + eval_cost<Q>::value;
+            /// @brief true when folding saves operations
+            static constexpr bool value = folded < nested;
+        };
+
+        /// @brief horner scheme on a lane of values, coefficients are broadcast from compile time constants
+        /// @tparam Lane scalar_lane or any vector lane
+        /// @tparam P polynomial (anything exposing degree and coeff_at_t)
+        template<typename Lane, typename P>
+        struct lane_horner {
+            using T = typename Lane::scalar;
+            using type = typename Lane::type;
+
+            template<size_t index, typename E = void>
+            struct inner {};
+
+            // accum holds coefficients from degree down to index + 1
+            template<size_t index>
+            struct inner<index, std::enable_if_t<(index > 0)>> {
+                static INLINED type func(const type accum, const type x) {
+                    constexpr T coeff = P::template coefficients<T>[index - 1];
+                    return inner<index - 1>::func(Lane::fma(x, accum, Lane::broadcast(coeff)), x);
+                }
+            };
+
+            template<size_t index>
+            struct inner<index, std::enable_if_t<(index == 0)>> {
+                static INLINED type func(const type accum, const type x) {
+                    return accum;
+                }
+            };
+
+            /// @brief P(x), evaluated in x^2 when P is even or odd (see parity_fold)
+            static INLINED type func(const type x) {
+                using fold = parity_fold<P>;
+                if constexpr (fold::value) {
+                    const type y = lane_horner<Lane, typename fold::half_t>::func(Lane::mul(x, x));
+                    if constexpr (fold::is_odd) {
+                        return Lane::mul(x, y);
+                    } else {
+                        return y;
+                    }
+                } else if constexpr (sparse_schedule<P>::value) {
+                    return sparse<0>(Lane::broadcast(P::template coefficients<T>[sparse_exponent<0>]), x);
+                } else {
+                    constexpr T coeff = P::template coefficients<T>[P::degree];
+                    return inner<P::degree>::func(Lane::broadcast(coeff), x);
+                }
+            }
+
+         private:
+            template<size_t i>
+            static constexpr size_t sparse_exponent = sparse_schedule<P>::exponents[i];
+
+            // accum holds the horner sum of nonzero coefficients down to exponent number i
+            template<size_t i>
+            static INLINED type sparse(const type accum, const type x) {
+                if constexpr (i + 1 < sparse_schedule<P>::count) {
+                    constexpr size_t e = sparse_exponent<i + 1>;
+                    constexpr T coeff = P::template coefficients<T>[e];
+                    const type xg = power_chain<sparse_exponent<i> - e>::template lane<Lane>(x);
+                    return sparse<i + 1>(Lane::fma(xg, accum, Lane::broadcast(coeff)), x);
+                } else if constexpr (sparse_exponent<i> > 0) {
+                    return Lane::mul(accum, power_chain<sparse_exponent<i>>::template lane<Lane>(x));
+                } else {
+                    return accum;
+                }
+            }
+        };
+
+        /// @brief two horner schemes on the same lane of values, interleaved step by step
+        ///
+        /// the two dependency chains are independent, so each step issues two fma that can execute in parallel
+        /// @tparam Lane scalar_lane or any vector lane
+        /// @tparam P1 first polynomial
+        /// @tparam P2 second polynomial
+        template<typename Lane, typename P1, typename P2>
+        struct lane_horner_pair {
+            using T = typename Lane::scalar;
+            using type = typename Lane::type;
+
+            template<size_t i1, size_t i2, typename E = void>
+            struct inner {};
+
+            // P1 is longer : advance it alone
+            template<size_t i1, size_t i2>
+            struct inner<i1, i2, std::enable_if_t<(i1 > i2)>> {
+                static INLINED void func(type *r1, type *r2, const type x) {
+                    constexpr T coeff = P1::template coefficients<T>[i1 - 1];
+                    *r1 = Lane::fma(x, *r1, Lane::broadcast(coeff));
+                    inner<i1 - 1, i2>::func(r1, r2, x);
+                }
+            };
+
+            // P2 is longer : advance it alone
+            template<size_t i1, size_t i2>
+            struct inner<i1, i2, std::enable_if_t<(i1 < i2)>> {
+                static INLINED void func(type *r1, type *r2, const type x) {
+                    constexpr T coeff = P2::template coefficients<T>[i2 - 1];
+                    *r2 = Lane::fma(x, *r2, Lane::broadcast(coeff));
+                    inner<i1, i2 - 1>::func(r1, r2, x);
+                }
+            };
+
+            template<size_t i1, size_t i2>
+            struct inner<i1, i2, std::enable_if_t<(i1 == i2 && i1 > 0)>> {
+                static INLINED void func(type *r1, type *r2, const type x) {
+                    constexpr T c1 = P1::template coefficients<T>[i1 - 1];
+                    constexpr T c2 = P2::template coefficients<T>[i2 - 1];
+                    *r1 = Lane::fma(x, *r1, Lane::broadcast(c1));
+                    *r2 = Lane::fma(x, *r2, Lane::broadcast(c2));
+                    inner<i1 - 1, i2 - 1>::func(r1, r2, x);
+                }
+            };
+
+            template<size_t i1, size_t i2>
+            struct inner<i1, i2, std::enable_if_t<(i1 == 0 && i2 == 0)>> {
+                static INLINED void func(type *r1, type *r2, const type x) {}
+            };
+
+            /// @brief r1 = P1(x), r2 = P2(x)
+            static INLINED void func(const type x, type *r1, type *r2) {
+                *r1 = Lane::broadcast(P1::template coefficients<T>[P1::degree]);
+                *r2 = Lane::broadcast(P2::template coefficients<T>[P2::degree]);
+                inner<P1::degree, P2::degree>::func(r1, r2, x);
+            }
+        };
+
+        /// @brief compensated horner scheme on a lane of values
+        ///
+        /// errors of each step are folded in the correction term as they are produced,
+        /// so no intermediate array is needed
+        /// @tparam Lane scalar_lane or any vector lane
+        /// @tparam P polynomial (anything exposing degree and coeff_at_t)
+        template<typename Lane, typename P>
+        struct lane_compensated_horner {
+            using T = typename Lane::scalar;
+            using type = typename Lane::type;
+
+            template<size_t index, typename E = void>
+            struct inner {};
+
+            template<size_t index>
+            struct inner<index, std::enable_if_t<(index > 0)>> {
+                static INLINED type func(const type r, const type c, const type x) {
+                    constexpr T coeff = P::template coefficients<T>[index - 1];
+                    type p, pi, next, sigma;
+                    Lane::two_prod(r, x, &p, &pi);
+                    Lane::two_sum(p, Lane::broadcast(coeff), &next, &sigma);
+                    return inner<index - 1>::func(next, Lane::fma(c, x, Lane::add(pi, sigma)), x);
+                }
+            };
+
+            template<size_t index>
+            struct inner<index, std::enable_if_t<(index == 0)>> {
+                static INLINED type func(const type r, const type c, const type x) {
+                    return Lane::add(r, c);
+                }
+            };
+
+            static INLINED type func(const type x) {
+                constexpr T coeff = P::template coefficients<T>[P::degree];
+                return inner<P::degree>::func(Lane::broadcast(coeff), Lane::broadcast(static_cast<T>(0)), x);
+            }
+        };
+
+        /// @brief value and first k derivatives on a lane of values, in a single horner sweep
+        ///
+        /// same nested accumulators as polynomial::derivatives_evaluation : d[j] holds P^(j) / j! until the end
+        /// @tparam Lane scalar_lane or any vector lane
+        /// @tparam P polynomial (anything exposing degree and coeff_at_t)
+        /// @tparam k number of derivatives
+        template<typename Lane, typename P, size_t k>
+        struct lane_horner_derivatives {
+            using T = typename Lane::scalar;
+            using type = typename Lane::type;
+
+            template<size_t index>
+            static INLINED void step(type* d, const type x) {
+                constexpr size_t top = k < P::degree - index ? k : P::degree - index;
+                for (size_t j = top; j > 0; --j) {
+                    d[j] = Lane::fma(x, d[j], d[j - 1]);
+                }
+                constexpr T coeff = P::template coefficients<T>[index];
+                d[0] = Lane::fma(x, d[0], Lane::broadcast(coeff));
+                if constexpr (index > 0) {
+                    step<index - 1>(d, x);
+                }
+            }
+
+            /// @brief d[j] = P^(j)(x) / j! for j in [0..k] : taylor coefficients of P at x
+            static INLINED void taylor(const type x, type* d) {
+                d[0] = Lane::broadcast(P::template coefficients<T>[P::degree]);
+                for (size_t j = 1; j <= k; ++j) {
+                    d[j] = Lane::broadcast(static_cast<T>(0));
+                }
+                if constexpr (P::degree > 0) {
+                    step<P::degree - 1>(d, x);
+                }
+            }
+
+            /// @brief d[j] = P^(j)(x) for j in [0..k]
+            static INLINED void func(const type x, type* d) {
+                taylor(x, d);
+                T factorial = static_cast<T>(1);
+                for (size_t j = 2; j <= k; ++j) {
+                    factorial *= static_cast<T>(j);
+                    d[j] = Lane::mul(d[j], Lane::broadcast(factorial));
+                }
+            }
+        };
+
+        /// @brief applies Kernel on in[0..n[ and writes results in out
+        ///
+        /// Scalar head until out is aligned on the lane boundary,
+        /// vector body (aligned or unaligned loads depending on in),
+        /// then scalar tail
+        /// @tparam T arithmetic type
+        /// @tparam Kernel must expose template<typename Lane> static Lane::type func(Lane::type)
+        template<typename T, typename Kernel>
+        struct batch_driver {
+            using Lane = best_lane_t<T>;
+            using Scalar = scalar_lane<T>;
+
+            static INLINED void run(const T* in, T* out, size_t n) {
+                size_t i = 0;
+                if constexpr (Lane::width > 1) {
+                    constexpr size_t align = Lane::alignment;
+                    const bool reachable = (reinterpret_cast<uintptr_t>(out) % sizeof(T)) == 0;
+                    if (reachable) {
+                        while (i < n && (reinterpret_cast<uintptr_t>(out + i) % align) != 0) {
+                            out[i] = Kernel::template func<Scalar>(in[i]);
+                            i += 1;
+                        }
+                    }
+                    const bool out_aligned = (reinterpret_cast<uintptr_t>(out + i) % align) == 0;
+                    const bool in_aligned = (reinterpret_cast<uintptr_t>(in + i) % align) == 0;
+                    if (out_aligned && in_aligned) {
+                        for (; i + Lane::width <= n; i += Lane::width) {
+                            Lane::store(out + i, Kernel::template func<Lane>(Lane::load(in + i)));
+                        }
+                    } else if (out_aligned) {
+                        for (; i + Lane::width <= n; i += Lane::width) {
+                            Lane::store(out + i, Kernel::template func<Lane>(Lane::loadu(in + i)));
+                        }
+                    } else {
+                        for (; i + Lane::width <= n; i += Lane::width) {
+                            Lane::storeu(out + i, Kernel::template func<Lane>(Lane::loadu(in + i)));
+                        }
+                    }
+                }
+                for (; i < n; ++i) {
+                    out[i] = Kernel::template func<Scalar>(in[i]);
+                }
+            }
+        };
+
+        /// @brief applies Kernel on (in1[i], in2[i]) for i in [0..n[ and writes results in out
+        ///
+        /// Scalar head until out is aligned on the lane boundary, vector body, then scalar tail
+        /// @tparam T arithmetic type
+        /// @tparam Kernel must expose template<typename Lane> static Lane::type func(Lane::type, Lane::type)
+        template<typename T, typename Kernel>
+        struct batch_driver_binary {
+            using Lane = best_lane_t<T>;
+            using Scalar = scalar_lane<T>;
+
+            static INLINED void run(const T* in1, const T* in2, T* out, size_t n) {
+                size_t i = 0;
+                if constexpr (Lane::width > 1) {
+                    constexpr size_t align = Lane::alignment;
+                    const bool reachable = (reinterpret_cast<uintptr_t>(out) % sizeof(T)) == 0;
+                    if (reachable) {
+                        while (i < n && (reinterpret_cast<uintptr_t>(out + i) % align) != 0) {
+                            out[i] = Kernel::template func<Scalar>(in1[i], in2[i]);
+                            i += 1;
+                        }
+                    }
+                    const bool out_aligned = (reinterpret_cast<uintptr_t>(out + i) % align) == 0;
+                    const bool in_aligned = (reinterpret_cast<uintptr_t>(in1 + i) % align) == 0 &&
+                        (reinterpret_cast<uintptr_t>(in2 + i) % align) == 0;
+                    if (out_aligned && in_aligned) {
+                        for (; i + Lane::width <= n; i += Lane::width) {
+                            Lane::store(out + i, Kernel::template func<Lane>(Lane::load(in1 + i), Lane::load(in2 + i)));
+                        }
+                    } else {
+                        for (; i + Lane::width <= n; i += Lane::width) {
+                            Lane::storeu(out + i,
+                                Kernel::template func<Lane>(Lane::loadu(in1 + i), Lane::loadu(in2 + i)));
+                        }
+                    }
+                }
+                for (; i < n; ++i) {
+                    out[i] = Kernel::template func<Scalar>(in1[i], in2[i]);
+                }
+            }
+        };
+
+        /// @brief applies Kernel on in[0..n[ and writes its two results in out1 and out2
+        ///
+        /// Scalar head until in is aligned on the lane boundary, vector body
+        /// (aligned stores when both outputs allow it), then scalar tail
+        /// @tparam T arithmetic type
+        /// @tparam Kernel must expose template<typename Lane> static void func(Lane::type, Lane::type*, Lane::type*)
+        template<typename T, typename Kernel>
+        struct batch_driver_pair {
+            using Lane = best_lane_t<T>;
+            using Scalar = scalar_lane<T>;
+
+            static INLINED void run(const T* in, T* out1, T* out2, size_t n) {
+                size_t i = 0;
+                if constexpr (Lane::width > 1) {
+                    constexpr size_t align = Lane::alignment;
+                    const bool reachable = (reinterpret_cast<uintptr_t>(in) % sizeof(T)) == 0;
+                    if (reachable) {
+                        while (i < n && (reinterpret_cast<uintptr_t>(in + i) % align) != 0) {
+                            Kernel::template func<Scalar>(in[i], out1 + i, out2 + i);
+                            i += 1;
+                        }
+                    }
+                    const bool in_aligned = (reinterpret_cast<uintptr_t>(in + i) % align) == 0;
+                    const bool out_aligned = (reinterpret_cast<uintptr_t>(out1 + i) % align) == 0 &&
+                        (reinterpret_cast<uintptr_t>(out2 + i) % align) == 0;
+                    typename Lane::type r1, r2;
+                    if (in_aligned && out_aligned) {
+                        for (; i + Lane::width <= n; i += Lane::width) {
+                            Kernel::template func<Lane>(Lane::load(in + i), &r1, &r2);
+                            Lane::store(out1 + i, r1);
+                            Lane::store(out2 + i, r2);
+                        }
+                    } else {
+                        for (; i + Lane::width <= n; i += Lane::width) {
+                            Kernel::template func<Lane>(Lane::loadu(in + i), &r1, &r2);
+                            Lane::storeu(out1 + i, r1);
+                            Lane::storeu(out2 + i, r2);
+                        }
+                    }
+                }
+                for (; i < n; ++i) {
+                    Kernel::template func<Scalar>(in[i], out1 + i, out2 + i);
+                }
+            }
+        };
+
+        /// @brief applies Kernel on in[0..n[ and writes its m results in out[0][0..n[, ..., out[m - 1][0..n[
+        ///
+        /// same head / body / tail split as batch_driver_pair
+        /// @tparam T arithmetic type
+        /// @tparam Kernel must expose template<typename Lane> static void func(Lane::type, Lane::type*)
+        /// @tparam m number of results
+        template<typename T, typename Kernel, size_t m>
+        struct batch_driver_multi {
+            using Lane = best_lane_t<T>;
+            using Scalar = scalar_lane<T>;
+
+            static INLINED void run(const T* in, T* const* out, size_t n) {
+                size_t i = 0;
+                T s[m];
+                if constexpr (Lane::width > 1) {
+                    constexpr size_t align = Lane::alignment;
+                    const bool reachable = (reinterpret_cast<uintptr_t>(in) % sizeof(T)) == 0;
+                    if (reachable) {
+                        while (i < n && (reinterpret_cast<uintptr_t>(in + i) % align) != 0) {
+                            Kernel::template func<Scalar>(in[i], s);
+                            for (size_t j = 0; j < m; ++j) {
+                                out[j][i] = s[j];
+                            }
+                            i += 1;
+                        }
+                    }
+                    const bool in_aligned = (reinterpret_cast<uintptr_t>(in + i) % align) == 0;
+                    bool out_aligned = true;
+                    for (size_t j = 0; j < m; ++j) {
+                        out_aligned = out_aligned && (reinterpret_cast<uintptr_t>(out[j] + i) % align) == 0;
+                    }
+                    typename Lane::type r[m];
+                    if (in_aligned && out_aligned) {
+                        for (; i + Lane::width <= n; i += Lane::width) {
+                            Kernel::template func<Lane>(Lane::load(in + i), r);
+                            for (size_t j = 0; j < m; ++j) {
+                                Lane::store(out[j] + i, r[j]);
+                            }
+                        }
+                    } else {
+                        for (; i + Lane::width <= n; i += Lane::width) {
+                            Kernel::template func<Lane>(Lane::loadu(in + i), r);
+                            for (size_t j = 0; j < m; ++j) {
+                                Lane::storeu(out[j] + i, r[j]);
+                            }
+                        }
+                    }
+                }
+                for (; i < n; ++i) {
+                    Kernel::template func<Scalar>(in[i], s);
+                    for (size_t j = 0; j < m; ++j) {
+                        out[j][i] = s[j];
+                    }
+                }
+            }
+        };
+
+        /// @brief P(x0 + i * step) for i in [0..n[ by forward differences
+        ///
+        /// each lane follows its own progression (points i, i + width, i + 2 width...) : at an anchor, the degree + 1
+        /// forward differences with step H = width * step are computed, then each vector of points costs degree
+        /// additions (no multiplication, no serial chain through the degree).
+        /// differences are not obtained by subtracting neighbour values (which cancel catastrophically) but from the
+        /// taylor coefficients c_m of P at the anchor : Delta^k = sum_m k! S(m, k) H^m c_m (S : stirling numbers of
+        /// the second kind), so their rounding errors stay relative to the size of taylor terms over the period.
+        /// the table is anchored again every `period` vectors of points
+        /// @tparam T arithmetic type
+        /// @tparam P polynomial
+        /// @tparam period number of vectors of points between two anchors
+        template<typename T, typename P, size_t period>
+        struct grid_driver {
+            using Lane = best_lane_t<T>;
+            using type = typename Lane::type;
+            static constexpr size_t degree = P::degree;
+            static constexpr size_t width = Lane::width;
+
+            // 0, 1, ..., width - 1
+            static constexpr std::array<T, width> iota = [] {
+                std::array<T, width> result {};
+                for (size_t l = 0; l < width; ++l) {
+                    result[l] = static_cast<T>(l);
+                }
+                return result;
+            }();
+
+            // stirling[k][m] = k! S(m, k) : Delta^k of j -> j^m at j = 0
+            static constexpr std::array<std::array<T, degree + 1>, degree + 1> stirling = [] {
+                std::array<std::array<long double, degree + 1>, degree + 1> S {};
+                S[0][0] = 1.0L;
+                for (size_t m = 1; m <= degree; ++m) {
+                    for (size_t k = 1; k <= m; ++k) {
+                        S[k][m] = static_cast<long double>(k) * S[k][m - 1] + S[k - 1][m - 1];
+                    }
+                }
+                std::array<std::array<T, degree + 1>, degree + 1> result {};
+                long double factorial = 1.0L;
+                for (size_t k = 0; k <= degree; ++k) {
+                    factorial *= k > 0 ? static_cast<long double>(k) : 1.0L;
+                    for (size_t m = k; m <= degree; ++m) {
+                        result[k][m] = static_cast<T>(factorial * S[k][m]);
+                    }
+                }
+                return result;
+            }();
+
+            // forward differences at points first, first + 1, ..., first + width - 1 (one per lane)
+            static INLINED void anchor(const T x0, const T step, const size_t first, type* D) {
+                const type index = Lane::add(Lane::loadu(iota.data()), Lane::broadcast(static_cast<T>(first)));
+                type c[degree + 1];
+                lane_horner_derivatives<Lane, P, degree>::taylor(
+                    Lane::fma(index, Lane::broadcast(step), Lane::broadcast(x0)), c);
+                // width is a power of two : H is exact
+                const T H = step * static_cast<T>(width);
+                T Hm = H;
+                for (size_t m = 1; m <= degree; ++m) {
+                    c[m] = Lane::mul(c[m], Lane::broadcast(Hm));
+                    Hm *= H;
+                }
+                // Delta^0 = P, then smallest terms first
+                D[0] = c[0];
+                for (size_t k = 1; k <= degree; ++k) {
+                    D[k] = Lane::mul(Lane::broadcast(stirling[k][degree]), c[degree]);
+                    for (size_t m = degree; m > k; --m) {
+                        D[k] = Lane::fma(Lane::broadcast(stirling[k][m - 1]), c[m - 1], D[k]);
+                    }
+                }
+            }
+
+            static INLINED void run(const T x0, const T step, size_t n, T* out) {
+                size_t i = 0;
+                type D[degree + 1];
+                while (i + width <= n) {
+                    anchor(x0, step, i, D);
+                    for (size_t s = 0; s < period && i + width <= n; ++s, i += width) {
+                        Lane::storeu(out + i, D[0]);
+                        for (size_t k = 0; k < degree; ++k) {
+                            D[k] = Lane::add(D[k], D[k + 1]);
+                        }
+                    }
+                }
+                for (; i < n; ++i) {
+                    out[i] = lane_horner<scalar_lane<T>, P>::func(
+                        fma_helper<T>::eval(static_cast<T>(i), step, x0));
+                }
+            }
+        };
+
+        template<typename P>
+        struct horner_kernel {
+            template<typename Lane>
+            static INLINED typename Lane::type func(const typename Lane::type x) {
+                return lane_horner<Lane, P>::func(x);
+            }
+        };
+
+        template<typename P>
+        struct compensated_horner_kernel {
+            template<typename Lane>
+            static INLINED typename Lane::type func(const typename Lane::type x) {
+                return lane_compensated_horner<Lane, P>::func(x);
+            }
+        };
+
+        template<typename P, size_t k>
+        struct derivatives_horner_kernel {
+            template<typename Lane>
+            static INLINED void func(const typename Lane::type x, typename Lane::type* d) {
+                lane_horner_derivatives<Lane, P, k>::func(x, d);
+            }
+        };
+    }  // namespace internal
+}  // namespace aerobus
+
+// type utilities
+namespace aerobus {
+    namespace internal {
+        template<template<typename...> typename TT, typename T>
+        struct is_instantiation_of : std::false_type { };
+
+        template<template<typename...> typename TT, typename... Ts>
+        struct is_instantiation_of<TT, TT<Ts...>> : std::true_type { };
+
+        template<template<typename...> typename TT, typename T>
+        inline constexpr bool is_instantiation_of_v = is_instantiation_of<TT, T>::value;
+
+        template <int64_t i, typename T, typename... Ts>
+        struct type_at {
+            static_assert(i < sizeof...(Ts) + 1, "index out of range");
+            using type = typename type_at<i - 1, Ts...>::type;
+        };
+
+        template <typename T, typename... Ts> struct type_at<0, T, Ts...> {
+            using type = T;
+        };
+
+        template <size_t i, typename... Ts>
+        using type_at_t = typename type_at<i, Ts...>::type;
+
+
+        template<size_t n, size_t i, typename E = void>
+        struct _is_prime {};
+
+        template<size_t i>
+        struct _is_prime<0, i> {
+            static constexpr bool value = false;
+        };
+
+        template<size_t i>
+        struct _is_prime<1, i> {
+            static constexpr bool value = false;
+        };
+
+        template<size_t i>
+        struct _is_prime<2, i> {
+            static constexpr bool value = true;
+        };
+
+        template<size_t i>
+        struct _is_prime<3, i> {
+            static constexpr bool value = true;
+        };
+
+        template<size_t i>
+        struct _is_prime<5, i> {
+            static constexpr bool value = true;
+        };
+
+        template<size_t i>
+        struct _is_prime<7, i> {
+            static constexpr bool value = true;
+        };
+
+        template<size_t n, size_t i>
+        struct _is_prime<n, i, std::enable_if_t<(n != 2 && n % 2 == 0)>> {
+            static constexpr bool value = false;
+        };
+
+        template<size_t n, size_t i>
+        struct _is_prime<n, i, std::enable_if_t<(n != 2 && n != 3 && n % 2 != 0 && n % 3 == 0)>> {
+            static constexpr bool value = false;
+        };
+
+        template<size_t n, size_t i>
+        struct _is_prime<n, i, std::enable_if_t<(n >= 9 && i * i > n)>> {
+            static constexpr bool value = true;
+        };
+
+        template<size_t n, size_t i>
+        struct _is_prime<n, i, std::enable_if_t<(
+            n % i == 0 &&
+            n >= 9 &&
+            n % 3 != 0 &&
+            n % 2 != 0 &&
+            i * i > n)>> {
+            static constexpr bool value = true;
+        };
+
+        template<size_t n, size_t i>
+        struct _is_prime<n, i, std::enable_if_t<(
+            n % (i+2) == 0 &&
+            n >= 9 &&
+            n % 3 != 0 &&
+            n % 2 != 0 &&
+            i * i <= n)>> {
+            static constexpr bool value = true;
+        };
+
+        template<size_t n, size_t i>
+        struct _is_prime<n, i, std::enable_if_t<(
+                n % (i+2) != 0 &&
+                n % i != 0 &&
+                n >= 9 &&
+                n % 3 != 0 &&
+                n % 2 != 0 &&
+                (i * i <= n))>> {
+            static constexpr bool value = _is_prime<n, i+6>::value;
+        };
+    }  // namespace internal
+
+    /// @brief checks if n is prime
+    /// @tparam n
+    template<size_t n>
+    struct is_prime {
+        /// @brief true iff n is prime
+        static constexpr bool value = internal::_is_prime<n, 5>::value;
+    };
+
+    /// @brief checks if n is prime
+    /// true if and only if is n is prime
+    /// @tparam n
+    template<size_t n>
+    static constexpr bool is_prime_v = is_prime<n>::value;
+
+    // gcd
+    namespace internal {
+        template <std::size_t... Is>
+        constexpr auto index_sequence_reverse(std::index_sequence<Is...> const&)
+            -> decltype(std::index_sequence<sizeof...(Is) - 1U - Is...>{});
+
+        template <std::size_t N>
+        using make_index_sequence_reverse
+            = decltype(index_sequence_reverse(std::make_index_sequence<N>{}));
+
+        /** @brief greatest common divisor
+         * computes the greatest common divisor
+         * exposes it in gcd<A, B>::type
+         * as long as Ring type is an integral domain
+        */
+        template<typename Ring, typename E = void>
+        struct gcd;
+
+        template<typename Ring>
+        struct gcd<Ring, std::enable_if_t<Ring::is_euclidean_domain>> {
+            template<typename A, typename B, typename E = void>
+            struct gcd_helper {};
+
+            // B = 0, A > 0
+            template<typename A, typename B>
+            struct gcd_helper<A, B, std::enable_if_t<
+                ((B::is_zero_t::value) &&
+                    (Ring::template gt_t<A, typename Ring::zero>::value))>> {
+                using type = A;
+            };
+
+            // B = 0, A < 0
+            template<typename A, typename B>
+            struct gcd_helper<A, B, std::enable_if_t<
+                ((B::is_zero_t::value) &&
+                    !(Ring::template gt_t<A, typename Ring::zero>::value))>> {
+                using type = typename Ring::template sub_t<typename Ring::zero, A>;
+            };
 
             // B != 0
             template<typename A, typename B>
@@ -1870,6 +3142,16 @@ namespace aerobus {
             template<size_t index>
             using coeff_at_t = typename coeff_at<index>::type;
 
+            /// @brief coefficients as a 64 bytes aligned table, lowest degree first :
+            /// coefficients<T>[i] == coeff_at_t<i>::get<T>()
+            ///
+            /// materialized once per arithmetic type and read by the SIMD lane kernels. Scalar kernels, which
+            /// may run in device code, keep reading coeff_at_t<i>::get<T>() : std::array is host only
+            /// @tparam arithmeticType usually float or double
+            template<typename arithmeticType>
+            alignas(64) static constexpr std::array<arithmeticType, degree + 1> coefficients =
+                internal::make_coefficients<val, arithmeticType>(std::make_index_sequence<degree + 1>());
+
             /// @brief get a string representation of polynomial
             /// @return something like a_n X^n + ... + a_1 X + a_0
             static std::string to_string() {
@@ -1877,24 +3159,53 @@ namespace aerobus {
             }
 
             /// @brief evaluates polynomial seen as a function operating on arithmeticType
+            ///
+            /// even and odd polynomials (such as taylor expansions of sin, cos, atan, sinh...) are detected
+            /// at compile time and evaluated in x^2 as Q(x^2) or x Q(x^2), with half the fma.
+            /// Long runs of zero coefficients are skipped with powers of x when cheaper (see sparse_schedule)
             /// @tparam arithmeticType usually float or double
             /// @param x value
             /// @return P(x)
             template<typename arithmeticType>
             static constexpr DEVICE INLINED arithmeticType eval(const arithmeticType& x) {
-                #ifdef WITH_CUDA_FP16
-                arithmeticType start;
-                if constexpr (std::is_same_v<arithmeticType, __half2>) {
-                    start = __half2(0, 0);
+                using fold = internal::parity_fold<val>;
+                if constexpr (fold::value) {
+                    if constexpr (fold::is_odd) {
+                        return x * fold::half_t::eval(x * x);
+                    } else {
+                        return fold::half_t::eval(x * x);
+                    }
+                } else if constexpr (internal::sparse_schedule<val>::value) {
+                    return sparse_evaluation<arithmeticType, val>::func(x);
                 } else {
-                    start = static_cast<arithmeticType>(0);
+                    #ifdef WITH_CUDA_FP16
+                    arithmeticType start;
+                    if constexpr (std::is_same_v<arithmeticType, __half2>) {
+                        start = __half2(0, 0);
+                    } else {
+                        start = static_cast<arithmeticType>(0);
+                    }
+                    #else
+                    arithmeticType start = static_cast<arithmeticType>(0);
+                    #endif
+                    return horner_evaluation<arithmeticType, val>
+                            ::template inner<0, degree + 1>
+                            ::func(start, x);
                 }
-                #else
-                arithmeticType start = static_cast<arithmeticType>(0);
-                #endif
-                return horner_evaluation<arithmeticType, val>
-                        ::template inner<0, degree + 1>
-                        ::func(start, x);
+            }
+
+            /// @brief evaluates polynomial using Estrin's scheme
+            ///
+            /// Same result as eval, up to rounding, but dependency chain has depth log2(degree) instead of degree,
+            /// which exposes instruction level parallelism on out-of-order cores for high degree polynomials
+            ///
+            /// Power tree (x, x^2, x^4, ...) and coefficients pairing are generated at compile time
+            /// @tparam arithmeticType usually float or double
+            /// @param x value
+            /// @return P(x)
+            template<typename arithmeticType>
+            static constexpr DEVICE INLINED arithmeticType eval_estrin(const arithmeticType& x) {
+                return estrin_evaluation<arithmeticType, val>::func(x);
             }
 
             /// @brief Evaluate polynomial on x using compensated horner scheme
@@ -1903,8 +3214,8 @@ namespace aerobus {
             ///
             /// Please note this makes no sense on integer types as arithmetic on integers is exact in IEEE
             ///
-            /// WARNING : this does not work with gcc with -O3 optimization level
-            /// because gcc does illegal stuff with floating point arithmetic
+            /// error free transformations use a hardware fma when available and resist contraction (gcc -O3)
+            /// as well as reassociation where __builtin_assoc_barrier exists
             ///
             /// \image examples/plots/comp_horner_vs_horner.png
             /// @tparam arithmeticType float for example
@@ -1914,6 +3225,72 @@ namespace aerobus {
                 return compensated_horner<arithmeticType, val>::func(x);
             }
 
+            /// @brief evaluates polynomial on n values in a batch
+            ///
+            /// uses explicit AVX-512 or AVX2 kernels when available (and scalar fallback otherwise),
+            /// with coefficients broadcast from compile time constants.
+            /// in and out may be unaligned and can alias (in == out), but must not partially overlap
+            /// @tparam arithmeticType usually float or double
+            /// @param in input values
+            /// @param out output values : out[i] = P(in[i])
+            /// @param n number of values
+            template<typename arithmeticType>
+            static INLINED void eval_n(const arithmeticType* in, arithmeticType* out, size_t n) {
+                internal::batch_driver<arithmeticType, internal::horner_kernel<val>>::run(in, out, n);
+            }
+
+            /// @brief batched version of compensated_eval -- see eval_n
+            /// @tparam arithmeticType usually float or double
+            /// @param in input values
+            /// @param out output values
+            /// @param n number of values
+            template<typename arithmeticType>
+            static INLINED void compensated_eval_n(const arithmeticType* in, arithmeticType* out, size_t n) {
+                internal::batch_driver<arithmeticType, internal::compensated_horner_kernel<val>>::run(in, out, n);
+            }
+
+            /// @brief evaluates polynomial and its first k derivatives in a single horner sweep
+            ///
+            /// cheaper than evaluating derive_t<val> separately (one pass, shared powers of x),
+            /// typically for Newton iterations (k = 1) or Halley iterations (k = 2)
+            /// @tparam k number of derivatives
+            /// @tparam arithmeticType usually float or double
+            /// @param x value
+            /// @return {P(x), P'(x), ..., P^(k)(x)}
+            template<size_t k, typename arithmeticType>
+            static constexpr DEVICE INLINED std::array<arithmeticType, k + 1> eval_with_derivatives(
+                const arithmeticType& x) {
+                return derivatives_evaluation<arithmeticType, val, k>::func(x);
+            }
+
+            /// @brief batched version of eval_with_derivatives -- see eval_n
+            /// @tparam k number of derivatives
+            /// @tparam arithmeticType usually float or double
+            /// @param in input values
+            /// @param out k + 1 output arrays of n values : out[j][i] = P^(j)(in[i])
+            /// @param n number of values
+            template<size_t k, typename arithmeticType>
+            static INLINED void eval_with_derivatives_n(
+                const arithmeticType* in, arithmeticType* const* out, size_t n) {
+                internal::batch_driver_multi<arithmeticType, internal::derivatives_horner_kernel<val, k>, k + 1>
+                    ::run(in, out, n);
+            }
+
+            /// @brief evaluates polynomial on a uniform grid : out[i] = P(x0 + i * step) for i in [0..n[
+            ///
+            /// forward differences initialized by horner, then degree additions per point (in vector lanes),
+            /// re-anchored with horner every `period` vectors of points to bound the drift of rounding errors
+            /// @tparam period vectors of points between two anchors : lower is more accurate, higher is faster
+            /// @tparam arithmeticType usually float or double
+            /// @param x0 first point
+            /// @param step grid step
+            /// @param n number of points
+            /// @param out output values
+            template<size_t period = 32, typename arithmeticType>
+            static INLINED void eval_grid(arithmeticType x0, arithmeticType step, size_t n, arithmeticType* out) {
+                internal::grid_driver<arithmeticType, val, period>::run(x0, step, n, out);
+            }
+
             template<typename x>
             using value_at_t = horner_reduction_t<val>
                 ::template inner<0, degree + 1>
@@ -1952,6 +3329,10 @@ namespace aerobus {
             template<size_t index>
             using coeff_at_t = typename coeff_at<index>::type;
 
+            template<typename arithmeticType>
+            alignas(64) static constexpr std::array<arithmeticType, 1> coefficients = {
+                coeffN::template get<arithmeticType>()};
+
             static std::string to_string() {
                 return string_helper<coeffN>::func();
             }
@@ -1961,11 +3342,44 @@ namespace aerobus {
                 return coeffN::template get<arithmeticType>();
             }
 
+            template<typename arithmeticType>
+            static constexpr DEVICE INLINED arithmeticType eval_estrin(const arithmeticType& x) {
+                return coeffN::template get<arithmeticType>();
+            }
+
             template<typename arithmeticType>
             static DEVICE INLINED arithmeticType compensated_eval(const arithmeticType& x) {
                 return coeffN::template get<arithmeticType>();
             }
 
+            template<typename arithmeticType>
+            static INLINED void eval_n(const arithmeticType* in, arithmeticType* out, size_t n) {
+                internal::batch_driver<arithmeticType, internal::horner_kernel<val>>::run(in, out, n);
+            }
+
+            template<typename arithmeticType>
+            static INLINED void compensated_eval_n(const arithmeticType* in, arithmeticType* out, size_t n) {
+                internal::batch_driver<arithmeticType, internal::compensated_horner_kernel<val>>::run(in, out, n);
+            }
+
+            template<size_t k, typename arithmeticType>
+            static constexpr DEVICE INLINED std::array<arithmeticType, k + 1> eval_with_derivatives(
+                const arithmeticType& x) {
+                return derivatives_evaluation<arithmeticType, val, k>::func(x);
+            }
+
+            template<size_t k, typename arithmeticType>
+            static INLINED void eval_with_derivatives_n(
+                const arithmeticType* in, arithmeticType* const* out, size_t n) {
+                internal::batch_driver_multi<arithmeticType, internal::derivatives_horner_kernel<val, k>, k + 1>
+                    ::run(in, out, n);
+            }
+
+            template<size_t period = 32, typename arithmeticType>
+            static INLINED void eval_grid(arithmeticType x0, arithmeticType step, size_t n, arithmeticType* out) {
+                internal::grid_driver<arithmeticType, val, period>::run(x0, step, n, out);
+            }
+
             template<typename x>
             using value_at_t = coeffN;
         };
@@ -2291,47 +3705,171 @@ namespace aerobus {
                 }
             };
 
-            template<size_t stop>
-            struct inner<stop, stop> {
-                static constexpr DEVICE INLINED arithmeticType func(
-                    const arithmeticType& accum, const arithmeticType& x) {
-                    return accum;
+            template<size_t stop>
+            struct inner<stop, stop> {
+                static constexpr DEVICE INLINED arithmeticType func(
+                    const arithmeticType& accum, const arithmeticType& x) {
+                    return accum;
+                }
+            };
+        };
+
+        // Estrin scheme : a_0 + ... + a_n x^n is split in (low) + x^(2^k) * (high)
+        // recursively, so that dependency chain has depth log2(n) instead of n
+        template<typename arithmeticType, typename P>
+        struct estrin_evaluation {
+            // largest power of two strictly smaller than count
+            static constexpr size_t split(size_t count) {
+                size_t result = 1;
+                while (2 * result < count) {
+                    result *= 2;
+                }
+                return result;
+            }
+
+            static constexpr size_t log2(size_t count) {
+                size_t result = 0;
+                while (count > 1) {
+                    count /= 2;
+                    result += 1;
+                }
+                return result;
+            }
+
+            // powers[i] = x^(2^i), enough to split degree + 1 coefficients
+            static constexpr size_t levels = log2(split(P::degree + 1)) + 1;
+
+            // a_start + a_{start+1} x + ... + a_{start+count-1} x^(count-1)
+            template<size_t start, size_t count, typename E = void>
+            struct inner {};
+
+            template<size_t start, size_t count>
+            struct inner<start, count, std::enable_if_t<(count == 1)>> {
+                static constexpr DEVICE INLINED arithmeticType func(const arithmeticType* powers) {
+                    return P::template coeff_at_t<start>::template get<arithmeticType>();
+                }
+            };
+
+            template<size_t start, size_t count>
+            struct inner<start, count, std::enable_if_t<(count > 1)>> {
+                static constexpr DEVICE INLINED arithmeticType func(const arithmeticType* powers) {
+                    constexpr size_t half = split(count);
+                    return internal::fma_helper<arithmeticType>::eval(
+                        powers[log2(half)],
+                        inner<start + half, count - half>::func(powers),
+                        inner<start, half>::func(powers));
                 }
             };
+
+            static constexpr DEVICE INLINED arithmeticType func(const arithmeticType& x) {
+                arithmeticType powers[levels];
+                powers[0] = x;
+                for (size_t i = 1; i < levels; ++i) {
+                    powers[i] = powers[i - 1] * powers[i - 1];
+                }
+                return inner<0, P::degree + 1>::func(powers);
+            }
         };
 
+        /// @brief compensated horner scheme, in a single pass
+        ///
+        /// rounding errors pi (of r * x) and sigma (of + a_i) are folded into the correction c = c * x + (pi + sigma)
+        /// as soon as they are produced (Graillat, Louvet and Langlois), instead of being stored in two arrays
+        /// and evaluated by a second horner loop : registers only, whatever the degree
+        ///
+        /// each step costs about 10 flops (two_prod, two_sum, correction) against one fma for horner, but only
+        /// the two_prod and two_sum feeding r are on the critical path : a single evaluation (latency bound) takes
+        /// about 2x horner, a loop over many points (throughput bound, see compensated_eval_n) about 8x
         template<typename arithmeticType, typename P>
         struct compensated_horner {
             template<int64_t index, int ghost>
             struct EFTHorner {
-                static INLINED DEVICE void func(
-                        arithmeticType x, arithmeticType *pi, arithmeticType *sigma, arithmeticType *r) {
-                    arithmeticType p;
-                    internal::two_prod(*r, x, &p, pi + P::degree - index - 1);
+                static INLINED DEVICE void func(arithmeticType x, arithmeticType *r, arithmeticType *c) {
+                    arithmeticType p, pi, sigma;
+                    internal::two_prod(*r, x, &p, &pi);
                     constexpr arithmeticType coeff = P::template coeff_at_t<index>::template get<arithmeticType>();
-                    internal::two_sum<arithmeticType>(
-                        p, coeff,
-                        r, sigma + P::degree - index - 1);
-                    EFTHorner<index - 1, ghost>::func(x, pi, sigma, r);
+                    internal::two_sum<arithmeticType>(p, coeff, r, &sigma);
+                    *c = internal::fma_helper<arithmeticType>::eval(*c, x, pi + sigma);
+                    EFTHorner<index - 1, ghost>::func(x, r, c);
                 }
             };
 
             template<int ghost>
             struct EFTHorner<-1, ghost> {
-                static INLINED DEVICE void func(
-                        arithmeticType x, arithmeticType *pi, arithmeticType *sigma, arithmeticType *r) {
+                static INLINED DEVICE void func(arithmeticType x, arithmeticType *r, arithmeticType *c) {
                 }
             };
 
             static INLINED DEVICE arithmeticType func(arithmeticType x) {
-                arithmeticType pi[P::degree], sigma[P::degree];
                 arithmeticType r = P::template coeff_at_t<P::degree>::template get<arithmeticType>();
-                EFTHorner<P::degree - 1, 0>::func(x, pi, sigma, &r);
-                arithmeticType c = internal::horner<arithmeticType, P::degree - 1>(pi, sigma, x);
+                arithmeticType c = static_cast<arithmeticType>(0);
+                EFTHorner<P::degree - 1, 0>::func(x, &r, &c);
                 return r + c;
             }
         };
 
+        // horner on nonzero coefficients only, see internal::sparse_schedule
+        template<typename arithmeticType, typename P>
+        struct sparse_evaluation {
+            using schedule = internal::sparse_schedule<P>;
+
+            template<size_t i>
+            static constexpr DEVICE INLINED arithmeticType inner(const arithmeticType& accum, const arithmeticType& x) {
+                constexpr size_t current = schedule::exponents[i];
+                if constexpr (i + 1 < schedule::count) {
+                    constexpr size_t next = schedule::exponents[i + 1];
+                    return inner<i + 1>(internal::fma_helper<arithmeticType>::eval(
+                        internal::power_chain<current - next>::func(x),
+                        accum,
+                        P::template coeff_at_t<next>::template get<arithmeticType>()), x);
+                } else if constexpr (current > 0) {
+                    return accum * internal::power_chain<current>::func(x);
+                } else {
+                    return accum;
+                }
+            }
+
+            static constexpr DEVICE INLINED arithmeticType func(const arithmeticType& x) {
+                return inner<0>(P::template coeff_at_t<schedule::exponents[0]>::template get<arithmeticType>(), x);
+            }
+        };
+
+        /// @brief value and first k derivatives in a single horner sweep
+        ///
+        /// d[j] accumulates P^(j)(x) / j! : each step updates d[j] = d[j] * x + d[j - 1] from the highest j down,
+        /// then d[0] = d[0] * x + a_i. Accumulators above degree - i are still zero and skipped
+        template<typename arithmeticType, typename P, size_t k>
+        struct derivatives_evaluation {
+            using result_t = std::array<arithmeticType, k + 1>;
+
+            template<size_t index>
+            static constexpr DEVICE INLINED void step(result_t* d, const arithmeticType& x) {
+                constexpr size_t top = k < P::degree - index ? k : P::degree - index;
+                for (size_t j = top; j > 0; --j) {
+                    (*d)[j] = internal::fma_helper<arithmeticType>::eval(x, (*d)[j], (*d)[j - 1]);
+                }
+                (*d)[0] = internal::fma_helper<arithmeticType>::eval(
+                    x, (*d)[0], P::template coeff_at_t<index>::template get<arithmeticType>());
+                if constexpr (index > 0) {
+                    step<index - 1>(d, x);
+                }
+            }
+
+            static constexpr DEVICE INLINED result_t func(const arithmeticType& x) {
+                result_t d {};
+                d[0] = P::template coeff_at_t<P::degree>::template get<arithmeticType>();
+                if constexpr (P::degree > 0) {
+                    step<P::degree - 1>(&d, x);
+                }
+                arithmeticType factorial = static_cast<arithmeticType>(1);
+                for (size_t j = 2; j <= k; ++j) {
+                    factorial = factorial * static_cast<arithmeticType>(j);
+                    d[j] = d[j] * factorial;
+                }
+                return d;
+            }
+        };
+
         template<typename coeff, typename... coeffs>
         struct string_helper {
             static std::string func() {
@@ -2442,6 +3980,37 @@ namespace aerobus {
         template<typename v>
         using derive_t = typename derive_helper<v>::type;
 
+     private:
+        // horner scheme in the polynomial ring : H_i = H_(i+1) Q + p_i
+        template<typename P, typename Q, size_t i, typename E = void>
+        struct compose_helper {
+            using type = add_t<
+                mul_t<typename compose_helper<P, Q, i + 1>::type, Q>,
+                val<typename P::template coeff_at_t<i>>>;
+        };
+
+        template<typename P, typename Q, size_t i>
+        struct compose_helper<P, Q, i, std::enable_if_t<(i >= P::degree)>> {
+            using type = val<typename P::aN>;
+        };
+
+     public:
+        /// @brief composition P(Q(x)), computed exactly
+        ///
+        /// of degree deg(P) deg(Q) : see fold_t to decide whether it is cheaper to evaluate than the nested calls
+        /// @tparam P
+        /// @tparam Q
+        template<typename P, typename Q>
+        using compose_t = typename compose_helper<P, Q, 0>::type;
+
+        /// @brief taylor shift P(x + a), computed exactly
+        ///
+        /// re-centres P : for x in [c - r, c + r], P(x) = shift_t<P, c>(x - c) may be much better conditioned
+        /// @tparam P
+        /// @tparam a a value in Ring
+        template<typename P, typename a>
+        using shift_t = compose_t<P, val<typename Ring::one, a>>;
+
         /// @brief checks for positivity (an > 0)
         /// @tparam v
         template<typename v>
@@ -2476,6 +4045,9 @@ namespace aerobus {
 // fraction field
 namespace aerobus {
     namespace internal {
+        template<typename T, typename... Ps>
+        struct many_horner;
+
         template<typename Ring, typename E = void>
         requires IsEuclideanDomain<Ring>
         struct _FractionField {};
@@ -2585,12 +4157,17 @@ namespace aerobus {
                 }
 
                 /// @brief evaluates fraction in arithmeticType : only used for rational fractions
+                ///
+                /// numerator and denominator horner chains are interleaved (see many_horner),
+                /// followed by a single division
                 /// @tparam arithmeticType : something like double
                 /// @param v
                 /// @return
                 template<typename arithmeticType>
                 static constexpr DEVICE INLINED arithmeticType eval(const arithmeticType& v) {
-                    return x::eval(v) / y::eval(v);
+                    arithmeticType r[2] {};
+                    internal::many_horner<arithmeticType, x, y>::func(v, r);
+                    return r[0] / r[1];
                 }
             };
 
@@ -2657,11 +4234,14 @@ namespace aerobus {
             template<typename v1, typename v2>
             struct add {
              private:
-                using a = typename Ring::template mul_t<typename v1::x, typename v2::y>;
-                using b = typename Ring::template mul_t<typename v1::y, typename v2::x>;
+                // common denominator is lcm(v1::y, v2::y), which keeps intermediate products small
+                using g = typename Ring::template gcd_t<typename v1::y, typename v2::y>;
+                using y1 = typename Ring::template div_t<typename v1::y, g>;
+                using y2 = typename Ring::template div_t<typename v2::y, g>;
+                using a = typename Ring::template mul_t<typename v1::x, y2>;
+                using b = typename Ring::template mul_t<y1, typename v2::x>;
                 using dividend = typename Ring::template add_t<a, b>;
-                using diviser = typename Ring::template mul_t<typename v1::y, typename v2::y>;
-                using g = typename Ring::template gcd_t<dividend, diviser>;
+                using diviser = typename Ring::template mul_t<typename v1::y, y2>;
 
              public:
                 using type = typename _FractionField<Ring>::template simplify_t<val<dividend, diviser>>;
@@ -2679,11 +4259,14 @@ namespace aerobus {
             template<typename v1, typename v2>
             struct sub {
              private:
-                using a = typename Ring::template mul_t<typename v1::x, typename v2::y>;
-                using b = typename Ring::template mul_t<typename v1::y, typename v2::x>;
+                // common denominator is lcm(v1::y, v2::y), which keeps intermediate products small
+                using g = typename Ring::template gcd_t<typename v1::y, typename v2::y>;
+                using y1 = typename Ring::template div_t<typename v1::y, g>;
+                using y2 = typename Ring::template div_t<typename v2::y, g>;
+                using a = typename Ring::template mul_t<typename v1::x, y2>;
+                using b = typename Ring::template mul_t<y1, typename v2::x>;
                 using dividend = typename Ring::template sub_t<a, b>;
-                using diviser = typename Ring::template mul_t<typename v1::y, typename v2::y>;
-                using g = typename Ring::template gcd_t<dividend, diviser>;
+                using diviser = typename Ring::template mul_t<typename v1::y, y2>;
 
              public:
                 using type = typename _FractionField<Ring>::template simplify_t<val<dividend, diviser>>;
@@ -3048,6 +4631,161 @@ namespace aerobus {
     template<typename Ring, auto... xs>
     using make_frac_polynomial_t = typename polynomial<FractionField<Ring>>::template val<
             typename FractionField<Ring>::template inject_constant_t<xs>...>;
+
+    namespace internal {
+        /// @brief k horner schemes at the same point
+        ///
+        /// even and odd polynomials are evaluated in x^2 (see parity_fold).
+        /// the k independent chains are interleaved step by step, each starting at its own degree,
+        /// which keeps the fma pipelines busy. Loops over many points are still vectorized by the compiler
+        /// (one point per lane), which is faster than spreading the k polynomials across lanes
+        /// @tparam T arithmetic type
+        /// @tparam Ps polynomials
+        template<typename T, typename... Ps>
+        struct many_horner {
+            static constexpr size_t k = sizeof...(Ps);
+            using result_t = std::array<T, k>;
+
+         private:
+            template<typename P>
+            static constexpr bool foldable = parity_fold<P>::is_even || parity_fold<P>::is_odd;
+
+            // polynomial actually evaluated by chain i, in x or in x^2
+            template<typename P, typename E = void>
+            struct chain {
+                using type = P;
+                static constexpr bool squared = false;
+                static constexpr bool odd = false;
+            };
+
+            template<typename P>
+            struct chain<P, std::enable_if_t<foldable<P>>> {
+                using type = typename parity_fold<P>::half_t;
+                static constexpr bool squared = true;
+                static constexpr bool odd = parity_fold<P>::is_odd;
+            };
+
+            template<size_t i>
+            using chain_at = chain<type_at_t<i, Ps...>>;
+
+            static constexpr size_t degree = std::max({chain<Ps>::type::degree...});
+
+            template<size_t index, size_t i>
+            static constexpr DEVICE INLINED void advance(T* r, const T& x, const T& y) {
+                using Q = typename chain_at<i>::type;
+                if constexpr (Q::degree > index) {
+                    r[i] = fma_helper<T>::eval(chain_at<i>::squared ? y : x, r[i],
+                        Q::template coeff_at_t<index>::template get<T>());
+                }
+            }
+
+            template<size_t index, size_t... I>
+            static constexpr DEVICE INLINED void steps(T* r, const T& x, const T& y, std::index_sequence<I...>) {
+                (advance<index, I>(r, x, y), ...);
+                if constexpr (index > 0) {
+                    steps<index - 1>(r, x, y, std::index_sequence<I...>());
+                }
+            }
+
+            template<size_t i>
+            static constexpr DEVICE INLINED T odd_factor(const T* r, const T& x) {
+                if constexpr (chain_at<i>::odd) {
+                    return x * r[i];
+                } else {
+                    return r[i];
+                }
+            }
+
+            template<size_t... I>
+            static constexpr DEVICE INLINED void interleaved(const T& x, T* r, std::index_sequence<I...>) {
+                const T y = x * x;
+                ((r[I] = chain_at<I>::type::template coeff_at_t<chain_at<I>::type::degree>::template get<T>()), ...);
+                if constexpr (degree > 0) {
+                    steps<degree - 1>(r, x, y, std::index_sequence<I...>());
+                }
+                ((r[I] = odd_factor<I>(r, x)), ...);
+            }
+
+            template<size_t... I>
+            static constexpr DEVICE INLINED result_t to_array(const T* r, std::index_sequence<I...>) {
+                return {r[I]...};
+            }
+
+         public:
+            /// @brief r[i] = Ps[i](x), without going through std::array (device code)
+            static constexpr DEVICE INLINED void func(const T& x, T* r) {
+                interleaved(x, r, std::index_sequence_for<Ps...>());
+            }
+
+            static constexpr DEVICE INLINED result_t func(const T& x) {
+                T r[k] {};
+                func(x, r);
+                return to_array(r, std::index_sequence_for<Ps...>());
+            }
+        };
+    }  // namespace internal
+
+    /// @brief evaluates several polynomials at the same point
+    ///
+    /// cheaper than k calls to eval : the k horner chains are independent and interleaved,
+    /// instead of each waiting on its own latency,
+    /// typically for families such as hermite_phys<0..N> or legendre<0..N>
+    /// @tparam Ps polynomials (possibly over different rings)
+    /// @tparam T arithmetic type, usually float or double
+    /// @param x value
+    /// @return {Ps::eval(x)...}
+    template<typename... Ps, typename T>
+    static constexpr DEVICE INLINED std::array<T, sizeof...(Ps)> eval_many(const T& x) {
+        return internal::many_horner<T, Ps...>::func(x);
+    }
+
+    namespace internal {
+        /// @brief P(Q(x)) evaluated as two nested calls
+        template<typename P, typename Q>
+        struct nested_evaluation {
+            template<typename T>
+            static constexpr DEVICE INLINED T eval(const T& x) {
+                return P::eval(Q::eval(x));
+            }
+        };
+
+        template<typename P, typename Q>
+        struct fold_pair {
+            using type = nested_evaluation<P, Q>;
+        };
+
+        template<typename P, typename Q>
+        requires std::is_same_v<typename P::enclosing_type, typename Q::enclosing_type> && fold_cost<P, Q>::value
+        struct fold_pair<P, Q> {
+            using type = typename P::enclosing_type::template compose_t<P, Q>;
+        };
+
+        template<typename... Ps>
+        struct fold;
+
+        template<typename P>
+        struct fold<P> {
+            using type = P;
+        };
+
+        template<typename P, typename Q, typename... Qs>
+        struct fold<P, Q, Qs...> {
+            using type = typename fold_pair<P, typename fold<Q, Qs...>::type>::type;
+        };
+    }  // namespace internal
+
+    /// @brief P_1(P_2(...P_k(x))), folded into a single polynomial where the cost model says it is cheaper
+    ///
+    /// pairs are folded from the innermost one, with internal::fold_cost. The result exposes eval in all cases,
+    /// and is the composed polynomial itself when everything folds
+    /// \code
+    /// using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, 0, 3, -1, 2>;
+    /// using Q = aerobus::make_int_polynomial_t<aerobus::i64, 2, -1>;  // 2x - 1 : affine, folded
+    /// double y = aerobus::fold_t<P, Q>::eval(0.3);  // single horner of degree 4 instead of 4 + 1 fma
+    /// \endcode
+    /// @tparam Ps polynomials, outermost first
+    template<typename... Ps>
+    using fold_t = typename internal::fold<Ps...>::type;
 }  // namespace aerobus
 
 // taylor series and common integers (factorial, bernoulli...) appearing in taylor coefficients
@@ -3546,16 +5284,15 @@ namespace aerobus {
 
         template<typename T, size_t i>
         struct asin_coeff_helper<T, i, std::enable_if_t<(i & 1) == 1>> {
-            using type = makefraction_t<T,
+            using type = typename FractionField<T>::template simplify_t<makefraction_t<T,
                 factorial_t<T, i - 1>,
                 typename T::template mul_t<
                     typename T::template val<i>,
-                    T::template mul_t<
+                    typename T::template mul_t<
                         pow_t<T, typename T::template inject_constant_t<4>, i / 2>,
-                        pow<T, factorial_t<T, i / 2>, 2
+                        pow_t<T, factorial_t<T, i / 2>, 2>
                     >
-                >
-                >>;
+                >>>;
         };
 
         template<typename T, size_t i>
@@ -3686,10 +5423,10 @@ namespace aerobus {
                     _4p,
                     typename FractionField<T>::template mul_t<
                         _4pm1,
-                        bernoulli_t<T, (i + 1)>>>::type;
+                        bernoulli_t<T, (i + 1)>>>;
         public:
             using type = typename FractionField<T>::template div_t<dividend,
-                FractionField<T>::template inject_t<factorial_t<T, i + 1>>>;
+                typename FractionField<T>::template inject_t<factorial_t<T, i + 1>>>;
         };
 
         template<typename T, size_t i>
@@ -3791,6 +5528,449 @@ namespace aerobus {
     /// @tparam deg taylor approximation degree
     template<typename Integers, size_t deg>
     using tanh = taylor<Integers, internal::tanh_coeff, deg>;
+
+    namespace internal {
+        // extended euclidean algorithm on (X^(m+n+1), T), stopped at the first remainder of degree <= m
+        // invariant : t_i * T = r_i mod X^(m+n+1), and deg(t_i) = m + n + 1 - deg(r_(i-1)) <= n at exit
+        template<typename P, size_t m, typename r0, typename r1, typename t0, typename t1, typename E = void>
+        struct pade_euclid {
+         private:
+            using q = typename P::template div_t<r0, r1>;
+            using r2 = typename P::template sub_t<r0, typename P::template mul_t<q, r1>>;
+            using t2 = typename P::template sub_t<t0, typename P::template mul_t<q, t1>>;
+
+         public:
+            using num = typename pade_euclid<P, m, r1, r2, t1, t2>::num;
+            using den = typename pade_euclid<P, m, r1, r2, t1, t2>::den;
+        };
+
+        template<typename P, size_t m, typename r0, typename r1, typename t0, typename t1>
+        struct pade_euclid<P, m, r0, r1, t0, t1, std::enable_if_t<(r1::degree <= m)>> {
+            using num = r1;
+            using den = t1;
+        };
+
+        template<typename Integers, template<typename, size_t> typename coeff_at, size_t m, size_t n>
+        struct pade {
+         private:
+            using Q = FractionField<Integers>;
+            using P = polynomial<Q>;
+            using series = typename P::template simplify_t<taylor<Integers, coeff_at, m + n>>;
+            using euclid = pade_euclid<P, m,
+                typename P::template monomial_t<typename Q::one, m + n + 1>, series,
+                typename P::zero, typename P::one>;
+            using c0 = typename euclid::den::template coeff_at_t<0>;
+            static_assert(!c0::is_zero_v, "Pade approximant does not exist (denominator vanishes at 0)");
+            using scale = typename P::template inject_ring_t<typename Q::template div_t<typename Q::one, c0>>;
+
+         public:
+            using type = typename FractionField<P>::template val<
+                typename P::template mul_t<typename euclid::num, scale>,
+                typename P::template mul_t<typename euclid::den, scale>>;
+        };
+    }  // namespace internal
+
+    /// @brief [m/n] Pade approximant of the function given by its taylor coefficients
+    ///
+    /// the rational function N/D, deg(N) <= m, deg(D) <= n, D(0) = 1, matching the taylor series up to
+    /// order m + n. Computed exactly at compile time (extended euclidean algorithm in FractionField<Integers>).
+    /// Often as accurate as a taylor polynomial of degree m + n, for about half the multiplications
+    /// (eval runs both horner chains interleaved and divides once)
+    /// @tparam Integers Ring type (for example i64)
+    /// @tparam coeff_at taylor coefficients (such as internal::exp_coeff)
+    /// @tparam m numerator degree
+    /// @tparam n denominator degree
+    template<typename Integers, template<typename, size_t> typename coeff_at, size_t m, size_t n>
+    using pade_t = typename internal::pade<Integers, coeff_at, m, n>::type;
+
+    namespace internal {
+        // |c_k| r^k
+        template<typename Integers, template<typename, size_t> typename coeff_at, typename Radius, size_t k>
+        static constexpr long double taylor_term = [] {
+            const long double c = coeff_at<Integers, k>::type::template get<long double>();
+            long double t = c < 0 ? -c : c;
+            for (size_t i = 0; i < k; ++i) {
+                t *= Radius::template get<long double>();
+            }
+            return t;
+        }();
+
+        // highest degree tried by taylor_for before giving up
+        static constexpr size_t taylor_max_degree = 64;
+
+        // bound of the remainder after degree d on [-r, r] : first omitted nonzero term t_k1 times the geometric
+        // tail 1 / (1 - t_k1 / t_k0), t_k0 being the last kept nonzero term. exact for ratios of consecutive
+        // nonzero terms that do not increase (exp, sin, cos, sinh, cos(x^2)...), whatever their spacing.
+        // zero when no nonzero term follows d up to taylor_max_degree (polynomials)
+        template<typename Integers, template<typename, size_t> typename coeff_at, typename Radius, size_t d>
+        struct taylor_remainder {
+         private:
+            template<size_t k>
+            static constexpr long double term = taylor_term<Integers, coeff_at, Radius, k>;
+
+            // terms are only read up to the first nonzero one :
+            // later ones may not be representable (21! in i64 for exp at degree 19).
+            // the first omitted term is always read, even past taylor_max_degree
+            template<size_t k>
+            static constexpr long double next_nonzero() {
+                if constexpr (k > d + 1 && k > taylor_max_degree) {
+                    return 0.0L;
+                } else if constexpr (term<k> != 0) {
+                    return term<k>;
+                } else {
+                    return next_nonzero<k + 1>();
+                }
+            }
+
+            template<size_t k>
+            static constexpr long double previous_nonzero() {
+                if constexpr (k == 0 || term<k> != 0) {
+                    return term<k>;
+                } else {
+                    return previous_nonzero<k - 1>();
+                }
+            }
+
+            static constexpr long double compute() {
+                const long double t1 = next_nonzero<d + 1>();
+                const long double t0 = previous_nonzero<d>();
+                if (t1 == 0) {
+                    return 0.0L;
+                }
+                if (t0 == 0 || t1 >= t0) {
+                    return std::numeric_limits<long double>::infinity();
+                }
+                return t1 / (1 - t1 / t0);
+            }
+
+         public:
+            static constexpr long double value = compute();
+        };
+
+        template<size_t d>
+        struct taylor_degree_not_found {
+            static_assert(d < taylor_max_degree,
+                "taylor_for : no degree up to taylor_max_degree reaches Epsilon "
+                "(is Radius inside the disk of convergence?)");
+        };
+
+        template<typename Integers, template<typename, size_t> typename coeff_at, typename Radius, typename Epsilon,
+                 size_t d, typename E = void>
+        struct taylor_degree : std::conditional_t<(d < taylor_max_degree),
+                                                  taylor_degree<Integers, coeff_at, Radius, Epsilon, d + 1>,
+                                                  taylor_degree_not_found<d>> {};
+
+        template<typename Integers, template<typename, size_t> typename coeff_at, typename Radius, typename Epsilon,
+                 size_t d>
+        struct taylor_degree<Integers, coeff_at, Radius, Epsilon, d, std::enable_if_t<
+            (taylor_remainder<Integers, coeff_at, Radius, d>::value <= Epsilon::template get<long double>())>> {
+            static constexpr size_t degree = d;
+            static constexpr long double bound = taylor_remainder<Integers, coeff_at, Radius, d>::value;
+        };
+    }  // namespace internal
+
+    /// @brief taylor expansion of smallest degree reaching a given absolute error on [-Radius, Radius]
+    ///
+    /// the remainder is bounded at compile time from the first omitted terms (see internal::taylor_remainder),
+    /// so that no fma is spent on terms below the target. for instance, exp on [-0.01, 0.01] to 1E-18 :
+    /// \code
+    /// using E = aerobus::taylor_for<aerobus::i64, aerobus::internal::exp_coeff, double,
+    ///                               aerobus::make_q64_t<1, 100>, aerobus::make_q64_t<1, 1000000000000000000>>;
+    /// static_assert(E::degree == 7);
+    /// \endcode
+    /// @tparam Integers Ring type (for example i64)
+    /// @tparam coeff_at taylor coefficients (such as internal::exp_coeff)
+    /// @tparam T arithmetic type of evaluation (double or float) : type of error_bound and eval only.
+    /// It does not take part in the degree search, which is not clamped to the precision of T :
+    /// an Epsilon below the rounding error of T buys terms that do not change the result
+    /// @tparam Radius radius of the evaluation interval (any value exposing get, such as make_q64_t<1, 100>)
+    /// @tparam Epsilon target absolute error, of the truncation only.
+    /// The build fails if no degree up to internal::taylor_max_degree reaches it
+    template<typename Integers, template<typename, size_t> typename coeff_at, typename T,
+             typename Radius, typename Epsilon>
+    struct taylor_for {
+     private:
+        using search = internal::taylor_degree<Integers, coeff_at, Radius, Epsilon, 0>;
+
+     public:
+        /// @brief smallest sufficient degree
+        static constexpr size_t degree = search::degree;
+        /// @brief the taylor polynomial, in polynomial<FractionField<Integers>>
+        using type = taylor<Integers, coeff_at, degree>;
+        /// @brief achieved bound of the truncation error on [-Radius, Radius]
+        static constexpr T error_bound = static_cast<T>(search::bound);
+
+        /// @brief evaluates the taylor polynomial
+        /// @param x value in [-Radius, Radius]
+        static constexpr DEVICE INLINED T eval(const T& x) {
+            return type::template eval<T>(x);
+        }
+    };
+
+    namespace internal {
+        /// @brief exact rational for constant evaluation, kept reduced with a positive denominator
+        ///
+        /// much cheaper to compile than the equivalent FractionField<i64> types, and just as safe :
+        /// a signed overflow is not a constant expression and fails the build
+        struct constexpr_rational {
+            int64_t num = 0;
+            int64_t den = 1;
+
+            static constexpr int64_t gcd(int64_t a, int64_t b) {
+                a = a < 0 ? -a : a;
+                b = b < 0 ? -b : b;
+                while (b != 0) {
+                    const int64_t t = a % b;
+                    a = b;
+                    b = t;
+                }
+                return a;
+            }
+
+            static constexpr constexpr_rational make(int64_t p, int64_t q) {
+                if (q < 0) {
+                    p = -p;
+                    q = -q;
+                }
+                const int64_t g = gcd(p, q);
+                return {p / g, q / g};
+            }
+
+            constexpr bool is_zero() const {
+                return num == 0;
+            }
+
+            friend constexpr constexpr_rational operator+(const constexpr_rational& a, const constexpr_rational& b) {
+                const int64_t g = gcd(a.den, b.den);
+                return make(a.num * (b.den / g) + b.num * (a.den / g), a.den * (b.den / g));
+            }
+
+            friend constexpr constexpr_rational operator-(const constexpr_rational& a, const constexpr_rational& b) {
+                return a + constexpr_rational {-b.num, b.den};
+            }
+
+            friend constexpr constexpr_rational operator*(const constexpr_rational& a, const constexpr_rational& b) {
+                const int64_t g1 = gcd(a.num, b.den);
+                const int64_t g2 = gcd(b.num, a.den);
+                return make((a.num / g1) * (b.num / g2), (a.den / g2) * (b.den / g1));
+            }
+
+            friend constexpr constexpr_rational operator/(const constexpr_rational& a, const constexpr_rational& b) {
+                return a * make(b.den, b.num);
+            }
+        };
+    }  // namespace internal
+
+    /// @brief truncated power series : FractionField<Integers>[[x]] modulo x^(N+1)
+    ///
+    /// values are plain polynomials of polynomial<FractionField<Integers>> of degree at most N,
+    /// so a fused series (such as exp(sin(x))) is built once at compile time and evaluated as a single polynomial :
+    /// \code
+    /// using S = aerobus::power_series<aerobus::i64, 12>;
+    /// using F = S::compose_t<S::from_taylor_t<aerobus::internal::exp_coeff>,
+    ///                        S::from_taylor_t<aerobus::internal::sin_coeff>>;
+    /// double y = F::eval(0.1);  // exp(sin(0.1)) up to x^12
+    /// \endcode
+    /// products, compositions and inversions are computed on exact rationals in constant evaluation
+    /// (see internal::constexpr_rational) and only the result is turned into a polynomial type
+    /// @tparam Integers Ring type (for example i64)
+    /// @tparam N truncation degree
+    template<typename Integers, size_t N>
+    struct power_series {
+        /// @brief coefficients field
+        using field = FractionField<Integers>;
+        /// @brief underlying polynomial ring
+        using poly = polynomial<field>;
+
+     private:
+        using rational = internal::constexpr_rational;
+        using series = std::array<rational, N + 1>;
+
+        template<typename P, size_t... I>
+        static constexpr series read(std::index_sequence<I...>) {
+            return {rational::make(P::template coeff_at_t<I>::x::v, P::template coeff_at_t<I>::y::v)...};
+        }
+
+        // coefficients of x^0 ... x^N of P
+        template<typename P>
+        static constexpr series coefficients = read<P>(std::make_index_sequence<N + 1>());
+
+        template<typename Op, typename I>
+        struct materialize;
+
+        template<typename Op, size_t... I>
+        struct materialize<Op, std::index_sequence<I...>> {
+            using type = typename poly::template simplify_t<typename poly::template val<typename field::template val<
+                typename Integers::template inject_constant_t<Op::value[I].num>,
+                typename Integers::template inject_constant_t<Op::value[I].den>>...>>;
+        };
+
+        template<typename Op>
+        using materialize_t = typename materialize<Op, internal::make_index_sequence_reverse<N + 1>>::type;
+
+        static constexpr series mul(const series& a, const series& b) {
+            series r {};
+            for (size_t i = 0; i <= N; ++i) {
+                for (size_t j = 0; i + j <= N; ++j) {
+                    r[i + j] = r[i + j] + a[i] * b[j];
+                }
+            }
+            return r;
+        }
+
+        // sum of f_j g^j : unlike horner's scheme, partial results keep the (small) denominators of g^j
+        static constexpr series compose(const series& f, const series& g) {
+            series r {};
+            series power {};
+            power[0] = rational {1, 1};
+            r[0] = f[0];
+            for (size_t j = 1; j <= N; ++j) {
+                power = mul(power, g);
+                for (size_t k = j; k <= N; ++k) {
+                    r[k] = r[k] + f[j] * power[k];
+                }
+            }
+            return r;
+        }
+
+        // b_0 = 1 / a_0, b_k = -(a_1 b_(k-1) + ... + a_k b_0) / a_0
+        static constexpr series inverse(const series& a) {
+            series b {};
+            b[0] = rational {1, 1} / a[0];
+            for (size_t k = 1; k <= N; ++k) {
+                rational acc {};
+                for (size_t j = 1; j <= k; ++j) {
+                    acc = acc + a[j] * b[k - j];
+                }
+                b[k] = rational {} - acc / a[0];
+            }
+            return b;
+        }
+
+        static constexpr size_t valuation(const series& a) {
+            size_t v = 0;
+            while (v < N && a[v].is_zero()) {
+                v += 1;
+            }
+            return v;
+        }
+
+        static constexpr series shift_down(const series& a, size_t v) {
+            series r {};
+            for (size_t k = v; k <= N; ++k) {
+                r[k - v] = a[k];
+            }
+            return r;
+        }
+
+        // terms above x^m of the shifted series come from terms of a beyond x^N, which were dropped
+        static constexpr series truncate(series a, size_t m) {
+            for (size_t k = m + 1; k <= N; ++k) {
+                a[k] = rational {};
+            }
+            return a;
+        }
+
+        // g <- g - (f(g) - x) / f_1 : one more exact coefficient per step
+        static constexpr series reversion(const series& f) {
+            series g {};
+            if constexpr (N > 0) {
+                g[1] = rational {1, 1} / f[1];
+                for (size_t step = 1; step < N; ++step) {
+                    series e = compose(f, g);
+                    e[1] = e[1] - rational {1, 1};
+                    for (size_t k = 0; k <= N; ++k) {
+                        g[k] = g[k] - e[k] / f[1];
+                    }
+                }
+            }
+            return g;
+        }
+
+        template<typename A, typename B>
+        struct mul_op {
+            static constexpr series value = mul(coefficients<A>, coefficients<B>);
+        };
+
+        template<typename F, typename G>
+        struct compose_op {
+            static constexpr series value = compose(coefficients<F>, coefficients<G>);
+        };
+
+        template<typename F>
+        struct inverse_op {
+            static constexpr series value = inverse(coefficients<F>);
+        };
+
+        template<typename A, typename B>
+        struct div_op {
+            static constexpr size_t v = valuation(coefficients<B>);
+            static_assert(valuation(coefficients<A>) >= v, "A must be divisible by the lowest power of x in B");
+            static constexpr series value =
+                truncate(mul(shift_down(coefficients<A>, v), inverse(shift_down(coefficients<B>, v))), N - v);
+        };
+
+        template<typename F>
+        struct reversion_op {
+            static constexpr series value = reversion(coefficients<F>);
+        };
+
+        template<typename P>
+        struct identity_op {
+            static constexpr series value = coefficients<P>;
+        };
+
+     public:
+        /// @brief drops the terms of degree above N
+        /// @tparam P polynomial in poly
+        template<typename P>
+        using truncate_t = materialize_t<identity_op<P>>;
+
+        /// @brief series of a taylor expansion, such as internal::exp_coeff
+        template<template<typename, size_t> typename coeff_at>
+        using from_taylor_t = truncate_t<taylor<Integers, coeff_at, N>>;
+
+        /// @brief constant zero
+        using zero = typename poly::zero;
+        /// @brief constant one
+        using one = typename poly::one;
+        /// @brief the series x
+        using X = truncate_t<typename poly::X>;
+
+        /// @brief addition
+        template<typename A, typename B>
+        using add_t = typename poly::template add_t<A, B>;
+
+        /// @brief subtraction
+        template<typename A, typename B>
+        using sub_t = typename poly::template sub_t<A, B>;
+
+        /// @brief multiplication (truncated)
+        template<typename A, typename B>
+        using mul_t = materialize_t<mul_op<A, B>>;
+
+        /// @brief composition F(G), G(0) must be zero
+        template<typename F, typename G>
+        requires (G::template coeff_at_t<0>::is_zero_v)
+        using compose_t = materialize_t<compose_op<F, G>>;
+
+        /// @brief multiplicative inverse 1 / F, F(0) must not be zero
+        template<typename F>
+        requires (!F::template coeff_at_t<0>::is_zero_v)
+        using inverse_t = materialize_t<inverse_op<F>>;
+
+        /// @brief division A / B
+        ///
+        /// the common factor x^v (v lowest nonzero degree of B) is cancelled first, as in sin(x) / x :
+        /// the result is then only known, and truncated, up to x^(N - v)
+        template<typename A, typename B>
+        using div_t = materialize_t<div_op<A, B>>;
+
+        /// @brief functional inverse G of F (F(G(x)) = x), F(0) must be zero and F'(0) must not
+        template<typename F>
+        requires (F::template coeff_at_t<0>::is_zero_v && !F::template coeff_at_t<1>::is_zero_v)
+        using reversion_t = materialize_t<reversion_op<F>>;
+    };
 }  // namespace aerobus
 
 // continued fractions
@@ -3841,90 +6021,87 @@ namespace aerobus {
 
 // known polynomials
 namespace aerobus {
-    // CChebyshev
+    // three term recurrences
     namespace internal {
-        template<int kind, size_t deg, typename I>
-        struct chebyshev_helper {
-            using type = typename polynomial<I>::template sub_t<
-                typename polynomial<I>::template mul_t<
-                    typename polynomial<I>::template mul_t<
-                        typename polynomial<I>::template inject_constant_t<2>,
-                        typename polynomial<I>::X>,
-                    typename chebyshev_helper<kind, deg - 1, I>::type
-                >,
-                typename chebyshev_helper<kind, deg - 2, I>::type
-            >;
-        };
+        // a_n x + b_n and c_n of P_n = (a_n x + b_n) P_(n-1) - c_n P_(n-2), as polynomials over R
+        template<typename Recurrence, size_t n, typename R>
+        struct three_term_factors {
+         private:
+            using P = polynomial<R>;
+            template<int64_t v>
+            using coeff = typename R::template div_t<
+                typename R::template inject_constant_t<v>,
+                typename R::template inject_constant_t<Recurrence::den(n)>>;
 
-        template<typename I>
-        struct chebyshev_helper<1, 0, I> {
-            using type = typename polynomial<I>::one;
+         public:
+            using ax_b = typename P::template val<coeff<Recurrence::a(n)>, coeff<Recurrence::b(n)>>;
+            using c = typename P::template inject_ring_t<coeff<Recurrence::c(n)>>;
         };
 
-        template<typename I>
-        struct chebyshev_helper<1, 1, I> {
-            using type = typename polynomial<I>::X;
+        /// @brief P_0 = 1, P_1 = a_1 x + b_1, P_n = (a_n x + b_n) P_(n-1) - c_n P_(n-2)
+        ///
+        /// Recurrence gives a_n, b_n and c_n as integers over a common denominator den(n) :
+        /// the same constants build the polynomials here and evaluate all degrees at once in three_term_all
+        /// @tparam Recurrence such as legendre_recurrence
+        /// @tparam n degree
+        /// @tparam R ring of coefficients (a field when den(n) is not 1)
+        template<typename Recurrence, size_t n, typename R>
+        struct three_term_helper {
+         private:
+            using P = polynomial<R>;
+            using factors = three_term_factors<Recurrence, n, R>;
+            using pnm1 = typename three_term_helper<Recurrence, n - 1, R>::type;
+            using pnm2 = typename three_term_helper<Recurrence, n - 2, R>::type;
+
+         public:
+            using type = typename P::template sub_t<
+                typename P::template mul_t<typename factors::ax_b, pnm1>,
+                typename P::template mul_t<typename factors::c, pnm2>>;
         };
 
-        template<typename I>
-        struct chebyshev_helper<2, 0, I> {
-            using type = typename polynomial<I>::one;
+        template<typename Recurrence, typename R>
+        struct three_term_helper<Recurrence, 0, R> {
+            using type = typename polynomial<R>::one;
         };
 
-        template<typename I>
-        struct chebyshev_helper<2, 1, I> {
-            using type = typename polynomial<I>::template mul_t<
-                typename polynomial<I>::template inject_constant_t<2>,
-                typename polynomial<I>::X>;
+        template<typename Recurrence, typename R>
+        struct three_term_helper<Recurrence, 1, R> {
+            using type = typename three_term_factors<Recurrence, 1, R>::ax_b;
         };
     }  // namespace internal
 
-    // Laguerre
+    // CChebyshev
     namespace internal {
-        template<size_t deg, typename I>
-        struct laguerre_helper {
-            using Q = FractionField<I>;
-            using PQ = polynomial<Q>;
-
-         private:
-            // Lk = (1 / k) * ((2 * k - 1 - x) * lkm1 - (k - 2)Lkm2)
-            using lnm2 = typename laguerre_helper<deg - 2, I>::type;
-            using lnm1 = typename laguerre_helper<deg - 1, I>::type;
-            // -x + 2k-1
-            using p = typename PQ::template val<
-                typename Q::template inject_constant_t<-1>,
-                typename Q::template inject_constant_t<2 * deg - 1>>;
-            // 1/n
-            using factor = typename PQ::template inject_ring_t<
-                typename Q::template val<typename I::one, typename I::template inject_constant_t<deg>>>;
+        template<int kind>
+        struct chebyshev_recurrence {
+            static constexpr bool affine = false;
+            static constexpr int64_t den(size_t n) { return 1; }
+            // T_1 = X, U_1 = 2X
+            static constexpr int64_t a(size_t n) { return n == 1 && kind == 1 ? 1 : 2; }
+            static constexpr int64_t b(size_t n) { return 0; }
+            static constexpr int64_t c(size_t n) { return 1; }
+        };
 
-         public:
-            using type = typename PQ::template mul_t <
-                factor,
-                typename PQ::template sub_t<
-                    typename PQ::template mul_t<
-                        p,
-                        lnm1
-                    >,
-                    typename PQ::template mul_t<
-                        typename PQ::template inject_constant_t<deg-1>,
-                        lnm2
-                    >
-                >
-            >;
+        template<int kind, size_t deg, typename I>
+        struct chebyshev_helper {
+            using type = typename three_term_helper<chebyshev_recurrence<kind>, deg, I>::type;
         };
+    }  // namespace internal
 
-        template<typename I>
-        struct laguerre_helper<0, I> {
-            using type = typename polynomial<FractionField<I>>::one;
+    // Laguerre
+    namespace internal {
+        // L_n = ((2n - 1 - x) L_(n-1) - (n - 1) L_(n-2)) / n
+        struct laguerre_recurrence {
+            static constexpr bool affine = true;
+            static constexpr int64_t den(size_t n) { return static_cast<int64_t>(n); }
+            static constexpr int64_t a(size_t n) { return -1; }
+            static constexpr int64_t b(size_t n) { return static_cast<int64_t>(2 * n - 1); }
+            static constexpr int64_t c(size_t n) { return static_cast<int64_t>(n - 1); }
         };
 
-        template<typename I>
-        struct laguerre_helper<1, I> {
-         private:
-            using PQ = polynomial<FractionField<I>>;
-         public:
-            using type = typename PQ::template sub_t<typename PQ::one, typename PQ::X>;
+        template<size_t deg, typename I>
+        struct laguerre_helper {
+            using type = typename three_term_helper<laguerre_recurrence, deg, FractionField<I>>::type;
         };
     }  // namespace internal
 
@@ -4042,111 +6219,52 @@ namespace aerobus {
 
     // hermite
     namespace internal {
+        // He_n = x He_(n-1) - (n - 1) He_(n-2)
+        struct hermite_prob_recurrence {
+            static constexpr bool affine = false;
+            static constexpr int64_t den(size_t n) { return 1; }
+            static constexpr int64_t a(size_t n) { return 1; }
+            static constexpr int64_t b(size_t n) { return 0; }
+            static constexpr int64_t c(size_t n) { return static_cast<int64_t>(n - 1); }
+        };
+
+        // H_n = 2x H_(n-1) - 2(n - 1) H_(n-2)
+        struct hermite_phys_recurrence {
+            static constexpr bool affine = false;
+            static constexpr int64_t den(size_t n) { return 1; }
+            static constexpr int64_t a(size_t n) { return 2; }
+            static constexpr int64_t b(size_t n) { return 0; }
+            static constexpr int64_t c(size_t n) { return static_cast<int64_t>(2 * (n - 1)); }
+        };
+
         template<size_t deg, known_polynomials::hermite_kind kind, typename I>
         struct hermite_helper {};
 
         template<size_t deg, typename I>
         struct hermite_helper<deg, known_polynomials::hermite_kind::probabilist, I> {
-         private:
-            using hnm1 = typename hermite_helper<deg - 1, known_polynomials::hermite_kind::probabilist, I>::type;
-            using hnm2 = typename hermite_helper<deg - 2, known_polynomials::hermite_kind::probabilist, I>::type;
-
-         public:
-            using type = typename polynomial<I>::template sub_t<
-                typename polynomial<I>::template mul_t<typename polynomial<I>::X, hnm1>,
-                typename polynomial<I>::template mul_t<
-                    typename polynomial<I>::template inject_constant_t<deg - 1>,
-                    hnm2
-                >
-            >;
+            using type = typename three_term_helper<hermite_prob_recurrence, deg, I>::type;
         };
 
         template<size_t deg, typename I>
         struct hermite_helper<deg, known_polynomials::hermite_kind::physicist, I> {
-         private:
-            using hnm1 = typename hermite_helper<deg - 1, known_polynomials::hermite_kind::physicist, I>::type;
-            using hnm2 = typename hermite_helper<deg - 2, known_polynomials::hermite_kind::physicist, I>::type;
-
-         public:
-            using type = typename polynomial<I>::template sub_t<
-                // 2X Hn-1
-                typename polynomial<I>::template mul_t<
-                    typename pi64::val<typename I::template inject_constant_t<2>,
-                    typename I::zero>, hnm1>,
-
-                typename polynomial<I>::template mul_t<
-                    typename polynomial<I>::template inject_constant_t<2*(deg - 1)>,
-                    hnm2
-                >
-            >;
-        };
-
-        template<typename I>
-        struct hermite_helper<0, known_polynomials::hermite_kind::probabilist, I> {
-            using type = typename polynomial<I>::one;
-        };
-
-        template<typename I>
-        struct hermite_helper<1, known_polynomials::hermite_kind::probabilist, I> {
-            using type = typename polynomial<I>::X;
-        };
-
-        template<typename I>
-        struct hermite_helper<0, known_polynomials::hermite_kind::physicist, I> {
-            using type = typename pi64::one;
-        };
-
-        template<typename I>
-        struct hermite_helper<1, known_polynomials::hermite_kind::physicist, I> {
-            // 2X
-            using type = typename polynomial<I>::template val<
-                typename I::template inject_constant_t<2>,
-                typename I::zero>;
+            using type = typename three_term_helper<hermite_phys_recurrence, deg, I>::type;
         };
     }  // namespace internal
 
     // legendre
     namespace internal {
-        template<size_t n, typename I>
-        struct legendre_helper {
-         private:
-            using Q = FractionField<I>;
-            using PQ = polynomial<Q>;
-            // 1/n constant
-            // (2n-1)/n X
-            using fact_left = typename PQ::template monomial_t<
-                makefraction_t<I,
-                    typename I::template inject_constant_t<2*n-1>,
-                    typename I::template inject_constant_t<n>
-                >,
-            1>;
-            // (n-1) / n
-            using fact_right = typename PQ::template val<
-                makefraction_t<I,
-                    typename I::template inject_constant_t<n-1>,
-                    typename I::template inject_constant_t<n>>>;
-
-         public:
-            using type = PQ::template sub_t<
-                    typename PQ::template mul_t<
-                        fact_left,
-                        typename legendre_helper<n-1, I>::type
-                    >,
-                    typename PQ::template mul_t<
-                        fact_right,
-                        typename legendre_helper<n-2, I>::type
-                    >
-                >;
-        };
-
-        template<typename I>
-        struct legendre_helper<0, I> {
-            using type = typename polynomial<FractionField<I>>::one;
+        // P_n = ((2n - 1) x P_(n-1) - (n - 1) P_(n-2)) / n
+        struct legendre_recurrence {
+            static constexpr bool affine = false;
+            static constexpr int64_t den(size_t n) { return static_cast<int64_t>(n); }
+            static constexpr int64_t a(size_t n) { return static_cast<int64_t>(2 * n - 1); }
+            static constexpr int64_t b(size_t n) { return 0; }
+            static constexpr int64_t c(size_t n) { return static_cast<int64_t>(n - 1); }
         };
 
-        template<typename I>
-        struct legendre_helper<1, I> {
-            using type = typename polynomial<FractionField<I>>::X;
+        template<size_t n, typename I>
+        struct legendre_helper {
+            using type = typename three_term_helper<legendre_recurrence, n, FractionField<I>>::type;
         };
     }  // namespace internal
 
@@ -4299,110 +6417,824 @@ namespace aerobus {
         template<size_t deg, typename I = aerobus::i64>
         using legendre = typename internal::legendre_helper<deg, I>::type;
 
-        /** @brief Bernoulli polynomials
-         * 
-         * Lives in polynomial<FractionField<I>>
-         * 
-         * @see [See in Wikipedia](https://en.wikipedia.org/wiki/Bernoulli_polynomials)
-         *
-         * @tparam deg degree of polynomial
-         * @tparam I Integers ring (defaults to aerobus::i64)
-         */
-        template<size_t deg, typename I = aerobus::i64>
-        using bernoulli = taylor<I, internal::bernoulli_coeff<deg>::template inner, deg>;
+        /** @brief Bernoulli polynomials
+         * 
+         * Lives in polynomial<FractionField<I>>
+         * 
+         * @see [See in Wikipedia](https://en.wikipedia.org/wiki/Bernoulli_polynomials)
+         *
+         * @tparam deg degree of polynomial
+         * @tparam I Integers ring (defaults to aerobus::i64)
+         */
+        template<size_t deg, typename I = aerobus::i64>
+        using bernoulli = taylor<I, internal::bernoulli_coeff<deg>::template inner, deg>;
+
+        /// @brief All One polynomials
+        ///
+        /// Lives in polynomial<I> with all coefficients at 1
+        ///
+        /// @tparam I Ring for coefficients defaults to aerobus::i64
+        /// @tparam deg degree of polynomial
+        template<size_t deg, typename I = aerobus::i64>
+        using allone = typename internal::AllOneHelper<deg, I>::type;
+
+        /// @brief Bessel polynomials
+        ///
+        /// Lives in aerobus::polynomial<I>
+        /// @see [See in Wikipedia](https://en.wikipedia.org/wiki/Bessel_polynomials)
+        ///
+        /// @tparam I ring for coefficients, defaults to aerobus::i64
+        /// @tparam deg degree of polynomial
+        template<size_t deg, typename I = aerobus::i64>
+        using bessel = typename internal::BesselHelper<deg, I>::type;
+
+        /// @brief Touchar polynomials
+        ///
+        /// Lives in aerobus::polynomial<I>
+        /// @see [See in Wikipedia](https://en.wikipedia.org/wiki/Touchard_polynomials)
+        ///
+        /// @tparam I ring for coefficients, defaults to aerobus::i64
+        /// @tparam deg degree of polynomial
+        template<size_t deg, typename I = aerobus::i64>
+        using touchard = taylor<I, internal::touchard_coeff<deg>::template inner, deg>;
+    }  // namespace known_polynomials
+
+    // three term recurrences, evaluating all degrees at once
+    namespace internal {
+        /// @brief P_0(x) ... P_N(x) in one pass of the three term recurrence
+        ///
+        /// O(N) operations instead of O(N^2) for N horner evaluations, and numerically stable
+        /// where monomial coefficients of high degree orthogonal polynomials suffer from cancellation
+        /// @tparam Recurrence one of the *_recurrence beside the polynomial helpers (see three_term_helper)
+        /// @tparam N highest degree
+        template<typename Recurrence, size_t N>
+        struct three_term_all {
+         private:
+            template<typename T>
+            static constexpr T ratio(int64_t num, int64_t den) {
+                return static_cast<T>(num) / static_cast<T>(den);
+            }
+
+            template<typename T, size_t... I>
+            static constexpr std::array<T, N + 1> make_a(std::index_sequence<I...>) {
+                return {static_cast<T>(0), ratio<T>(Recurrence::a(I + 1), Recurrence::den(I + 1))...};
+            }
+
+            template<typename T, size_t... I>
+            static constexpr std::array<T, N + 1> make_b(std::index_sequence<I...>) {
+                return {static_cast<T>(0), ratio<T>(Recurrence::b(I + 1), Recurrence::den(I + 1))...};
+            }
+
+            template<typename T, size_t... I>
+            static constexpr std::array<T, N + 1> make_c(std::index_sequence<I...>) {
+                return {static_cast<T>(0), ratio<T>(Recurrence::c(I + 1), Recurrence::den(I + 1))...};
+            }
+
+            // constants indexed by n, rounded once at compile time, for the SIMD lanes (host only)
+            template<typename T>
+            static constexpr std::array<T, N + 1> as = make_a<T>(std::make_index_sequence<N>());
+            template<typename T>
+            static constexpr std::array<T, N + 1> bs = make_b<T>(std::make_index_sequence<N>());
+            template<typename T>
+            static constexpr std::array<T, N + 1> cs = make_c<T>(std::make_index_sequence<N>());
+
+            // scalar step : compile time n, so that constants are folded without reading the tables (device code)
+            template<typename T, size_t n>
+            static constexpr DEVICE INLINED void step(const T& x, T* out) {
+                constexpr T a = ratio<T>(Recurrence::a(n), Recurrence::den(n));
+                constexpr T b = ratio<T>(Recurrence::b(n), Recurrence::den(n));
+                constexpr T c = ratio<T>(Recurrence::c(n), Recurrence::den(n));
+                if constexpr (n == 1) {
+                    out[1] = fma_helper<T>::eval(a, x, b);
+                } else {
+                    const T ax = Recurrence::affine ? fma_helper<T>::eval(a, x, b) : a * x;
+                    out[n] = ax * out[n - 1] - c * out[n - 2];
+                }
+            }
+
+            template<typename T, size_t... I>
+            static constexpr DEVICE INLINED void steps(const T& x, T* out, std::index_sequence<I...>) {
+                (step<T, I + 1>(x, out), ...);
+            }
+
+         public:
+            /// @brief out[n] = P_n(x) for n in [0..N]
+            template<typename T>
+            static constexpr DEVICE INLINED void eval(const T& x, T* out) {
+                out[0] = static_cast<T>(1);
+                steps(x, out, std::make_index_sequence<N>());
+            }
+
+            /// @brief lane version of eval, for batch_driver_multi
+            template<typename Lane>
+            static INLINED void func(const typename Lane::type x, typename Lane::type* out) {
+                using T = typename Lane::scalar;
+                using type = typename Lane::type;
+                out[0] = Lane::broadcast(static_cast<T>(1));
+                if constexpr (N > 0) {
+                    out[1] = Lane::fma(Lane::broadcast(as<T>[1]), x, Lane::broadcast(bs<T>[1]));
+                }
+                for (size_t n = 2; n <= N; ++n) {
+                    const type ax = Recurrence::affine ?
+                        Lane::fma(Lane::broadcast(as<T>[n]), x, Lane::broadcast(bs<T>[n])) :
+                        Lane::mul(Lane::broadcast(as<T>[n]), x);
+                    out[n] = Lane::fnma(Lane::broadcast(cs<T>[n]), out[n - 2], Lane::mul(ax, out[n - 1]));
+                }
+            }
+        };
+    }  // namespace internal
+
+    namespace known_polynomials {
+        /// @brief hermite_phys<0>(x), ..., hermite_phys<N>(x) by the three term recurrence
+        /// @tparam N highest degree
+        /// @tparam T arithmetic type, usually float or double
+        /// @param x value
+        /// @param out N + 1 values : out[n] = H_n(x)
+        template<size_t N, typename T>
+        static constexpr DEVICE INLINED void hermite_phys_all(const T& x, T* out) {
+            internal::three_term_all<internal::hermite_phys_recurrence, N>::eval(x, out);
+        }
+
+        /// @brief batched version of hermite_phys_all
+        ///
+        /// vectorized over in (AVX-512, AVX2 or scalar), see polynomial::eval_with_derivatives_n
+        /// @tparam N highest degree
+        /// @tparam T arithmetic type, usually float or double
+        /// @param in input values
+        /// @param out N + 1 output arrays of n values : out[k][i] = H_k(in[i])
+        /// @param n number of values
+        template<size_t N, typename T>
+        static INLINED void hermite_phys_all_n(const T* in, T* const* out, size_t n) {
+            internal::batch_driver_multi<T, internal::three_term_all<internal::hermite_phys_recurrence, N>, N + 1>
+                ::run(in, out, n);
+        }
+
+        /// @brief hermite_prob<0>(x), ..., hermite_prob<N>(x) by the three term recurrence -- see hermite_phys_all
+        template<size_t N, typename T>
+        static constexpr DEVICE INLINED void hermite_prob_all(const T& x, T* out) {
+            internal::three_term_all<internal::hermite_prob_recurrence, N>::eval(x, out);
+        }
+
+        /// @brief batched version of hermite_prob_all -- see hermite_phys_all_n
+        template<size_t N, typename T>
+        static INLINED void hermite_prob_all_n(const T* in, T* const* out, size_t n) {
+            internal::batch_driver_multi<T, internal::three_term_all<internal::hermite_prob_recurrence, N>, N + 1>
+                ::run(in, out, n);
+        }
+
+        /// @brief legendre<0>(x), ..., legendre<N>(x) by the three term recurrence -- see hermite_phys_all
+        template<size_t N, typename T>
+        static constexpr DEVICE INLINED void legendre_all(const T& x, T* out) {
+            internal::three_term_all<internal::legendre_recurrence, N>::eval(x, out);
+        }
+
+        /// @brief batched version of legendre_all -- see hermite_phys_all_n
+        template<size_t N, typename T>
+        static INLINED void legendre_all_n(const T* in, T* const* out, size_t n) {
+            internal::batch_driver_multi<T, internal::three_term_all<internal::legendre_recurrence, N>, N + 1>
+                ::run(in, out, n);
+        }
+
+        /// @brief laguerre<0>(x), ..., laguerre<N>(x) by the three term recurrence -- see hermite_phys_all
+        template<size_t N, typename T>
+        static constexpr DEVICE INLINED void laguerre_all(const T& x, T* out) {
+            internal::three_term_all<internal::laguerre_recurrence, N>::eval(x, out);
+        }
+
+        /// @brief batched version of laguerre_all -- see hermite_phys_all_n
+        template<size_t N, typename T>
+        static INLINED void laguerre_all_n(const T* in, T* const* out, size_t n) {
+            internal::batch_driver_multi<T, internal::three_term_all<internal::laguerre_recurrence, N>, N + 1>
+                ::run(in, out, n);
+        }
+
+        /// @brief chebyshev_T<0>(x), ..., chebyshev_T<N>(x) by the three term recurrence -- see hermite_phys_all
+        template<size_t N, typename T>
+        static constexpr DEVICE INLINED void chebyshev_T_all(const T& x, T* out) {
+            internal::three_term_all<internal::chebyshev_recurrence<1>, N>::eval(x, out);
+        }
+
+        /// @brief batched version of chebyshev_T_all -- see hermite_phys_all_n
+        template<size_t N, typename T>
+        static INLINED void chebyshev_T_all_n(const T* in, T* const* out, size_t n) {
+            internal::batch_driver_multi<T, internal::three_term_all<internal::chebyshev_recurrence<1>, N>, N + 1>
+                ::run(in, out, n);
+        }
+
+        /// @brief chebyshev_U<0>(x), ..., chebyshev_U<N>(x) by the three term recurrence -- see hermite_phys_all
+        template<size_t N, typename T>
+        static constexpr DEVICE INLINED void chebyshev_U_all(const T& x, T* out) {
+            internal::three_term_all<internal::chebyshev_recurrence<2>, N>::eval(x, out);
+        }
+
+        /// @brief batched version of chebyshev_U_all -- see hermite_phys_all_n
+        template<size_t N, typename T>
+        static INLINED void chebyshev_U_all_n(const T* in, T* const* out, size_t n) {
+            internal::batch_driver_multi<T, internal::three_term_all<internal::chebyshev_recurrence<2>, N>, N + 1>
+                ::run(in, out, n);
+        }
+    }  // namespace known_polynomials
+
+    // chebyshev approximations
+    namespace internal {
+        /// @brief cos(x) for x in [0, pi], in constant evaluation (taylor series on [-pi/2, pi/2])
+        static constexpr long double constexpr_cos(long double x) {
+            constexpr long double pi = 3.141592653589793238462643383279502884L;
+            long double sign = 1.0L;
+            if (x > pi / 2) {
+                x = pi - x;
+                sign = -1.0L;
+            }
+            long double term = 1.0L, sum = 1.0L;
+            for (int k = 1; k < 20; ++k) {
+                term *= -x * x / static_cast<long double>((2 * k - 1) * (2 * k));
+                sum += term;
+            }
+            return sign * sum;
+        }
+
+        /// @brief chebyshev coefficients of F on [a, b], computed at compile time in long double
+        ///
+        /// interpolation at the N + 1 chebyshev nodes t_j = cos(pi (j + 1/2) / (N + 1)) :
+        /// c_k = 2 / (N + 1) sum_j F(x_j) T_k(t_j), T_k given by known_polynomials::chebyshev_T_all,
+        /// c_0 is halved so that F(x) ~ sum_k c_k T_k(u)
+        template<typename F, typename A, typename B, size_t N>
+        struct chebyshev_coefficients {
+            static constexpr long double a = A::template get<long double>();
+            static constexpr long double b = B::template get<long double>();
+
+            static constexpr std::array<long double, N + 1> compute() {
+                constexpr long double pi = 3.141592653589793238462643383279502884L;
+                std::array<long double, N + 1> c {};
+                for (size_t j = 0; j <= N; ++j) {
+                    const long double t = constexpr_cos(pi * (static_cast<long double>(j) + 0.5L) / (N + 1));
+                    const long double fx = static_cast<long double>(F {}((a + b) / 2 + (b - a) / 2 * t));
+                    std::array<long double, N + 1> tk {};
+                    known_polynomials::chebyshev_T_all<N>(t, tk.data());
+                    for (size_t k = 0; k <= N; ++k) {
+                        c[k] += fx * tk[k];
+                    }
+                }
+                for (size_t k = 0; k <= N; ++k) {
+                    c[k] *= (k == 0 ? 1.0L : 2.0L) / (N + 1);
+                }
+                return c;
+            }
+
+            static constexpr std::array<long double, N + 1> value = compute();
+        };
+    }  // namespace internal
+
+    /// @brief compile time chebyshev approximation of F on [A, B], evaluated with Clenshaw's recurrence
+    ///
+    /// for smooth functions, the chebyshev interpolant is close to the minimax polynomial :
+    /// far more accurate than a taylor series of the same degree on the whole interval, hence fewer fma
+    ///
+    /// example : exp on [-1, 1] to double precision
+    /// \code
+    /// constexpr auto f = [](auto x) { return aerobus::exp<aerobus::i64, 20>::eval(x); };
+    /// using E = aerobus::chebyshev_approximation<decltype(f), aerobus::make_q64_t<-1, 1>,
+    ///                                            aerobus::make_q64_t<1, 1>, 14>;
+    /// double y = E::eval(0.3);
+    /// \endcode
+    /// @tparam F default constructible callable (e.g. a lambda without capture), invoked on long double
+    /// in constant evaluation
+    /// @tparam A lower bound of interval (any value exposing get, such as make_q64_t<-1, 1>)
+    /// @tparam B upper bound of interval
+    /// @tparam N degree
+    template<typename F, typename A, typename B, size_t N>
+    struct chebyshev_approximation {
+        /// @brief degree
+        static constexpr size_t degree = N;
+
+        /// @brief chebyshev coefficients c_0 ... c_N : F(x) ~ sum_k c_k T_k((2x - A - B) / (B - A))
+        /// @tparam T arithmetic type
+        template<typename T>
+        alignas(64) static constexpr std::array<T, N + 1> coefficients = [] {
+            std::array<T, N + 1> result {};
+            for (size_t k = 0; k <= N; ++k) {
+                result[k] = static_cast<T>(internal::chebyshev_coefficients<F, A, B, N>::value[k]);
+            }
+            return result;
+        }();
+
+     private:
+        static constexpr long double a = internal::chebyshev_coefficients<F, A, B, N>::a;
+        static constexpr long double b = internal::chebyshev_coefficients<F, A, B, N>::b;
+
+        // u = x * scale + offset maps [A, B] to [-1, 1]
+        template<typename T>
+        static constexpr T scale = static_cast<T>(2.0L / (b - a));
+        template<typename T>
+        static constexpr T offset = static_cast<T>(-(a + b) / (b - a));
+
+     public:
+        /// @brief evaluates the approximation with Clenshaw's recurrence
+        ///
+        /// b_k = 2u b_(k+1) - b_(k+2) + c_k, then F(x) ~ u b_1 - b_2 + c_0 : N + 1 fma after the affine map.
+        /// host only : coefficients and interval bounds are std::array and long double constants
+        /// @tparam T arithmetic type, usually float or double
+        /// @param x value in [A, B]
+        template<typename T>
+        static constexpr INLINED T eval(const T& x) {
+            const T u = internal::fma_helper<T>::eval(x, scale<T>, offset<T>);
+            if constexpr (N == 0) {
+                return coefficients<T>[0];
+            } else {
+                const T u2 = u + u;
+                T b1 = coefficients<T>[N];
+                T b2 = static_cast<T>(0);
+                for (size_t k = N - 1; k > 0; --k) {
+                    const T tmp = internal::fma_helper<T>::eval(u2, b1, coefficients<T>[k] - b2);
+                    b2 = b1;
+                    b1 = tmp;
+                }
+                return internal::fma_helper<T>::eval(u, b1, coefficients<T>[0] - b2);
+            }
+        }
+
+        /// @brief batched version of eval -- see polynomial::eval_n
+        /// @tparam T arithmetic type, usually float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void eval_n(const T* in, T* out, size_t n) {
+            internal::batch_driver<T, clenshaw_kernel>::run(in, out, n);
+        }
+
+     private:
+        struct clenshaw_kernel {
+            template<typename Lane>
+            static INLINED typename Lane::type func(const typename Lane::type x) {
+                using T = typename Lane::scalar;
+                using type = typename Lane::type;
+                const type u = Lane::fma(x, Lane::broadcast(scale<T>), Lane::broadcast(offset<T>));
+                if constexpr (N == 0) {
+                    return Lane::broadcast(coefficients<T>[0]);
+                } else {
+                    const type u2 = Lane::add(u, u);
+                    type b1 = Lane::broadcast(coefficients<T>[N]);
+                    type b2 = Lane::broadcast(static_cast<T>(0));
+                    for (size_t k = N - 1; k > 0; --k) {
+                        const type tmp = Lane::fma(u2, b1, Lane::sub(Lane::broadcast(coefficients<T>[k]), b2));
+                        b2 = b1;
+                        b1 = tmp;
+                    }
+                    return Lane::fma(u, b1, Lane::sub(Lane::broadcast(coefficients<T>[0]), b2));
+                }
+            }
+        };
+    };
+}  // namespace aerobus
+
+// minimax approximations
+namespace aerobus {
+    namespace internal {
+        /// @brief remez exchange algorithm, at compile time in long double
+        ///
+        /// minimizes max |F(x) - sum_j c_j x^K_j| on [a, b] over n = sizeof...(K) coefficients.
+        /// the reference is a set of n + 1 points where the error alternates : each step solves
+        /// sum_j c_j x_i^K_j + (-1)^i E = F(x_i), then moves the reference to the extrema of the error (one per run
+        /// of constant sign on a uniform grid), until the levelled error E matches the actual maximal error.
+        /// the monomials must form a Haar system on [a, b] : any set of exponents does, as long as 0 is not
+        /// inside the interval (approximate even or odd functions on [0, b])
+        template<typename F, typename A, typename B, size_t... K>
+        struct remez {
+            static constexpr size_t n = sizeof...(K);
+            static constexpr size_t degree = std::max({K...});
+            static constexpr long double a = A::template get<long double>();
+            static constexpr long double b = B::template get<long double>();
+
+            /// @brief coefficients of x^0 ... x^degree and maximal error on [a, b]
+            struct result_t {
+                std::array<long double, degree + 1> coefficients;
+                long double error;
+            };
+
+         private:
+            static constexpr size_t m = n + 1;
+            static constexpr size_t grid = 128 * m;
+            static constexpr size_t max_iterations = 32;
+            static constexpr std::array<size_t, n> exponents = {K...};
+
+            static constexpr long double abs(long double x) {
+                return x < 0 ? -x : x;
+            }
+
+            static constexpr long double error_at(const std::array<long double, degree + 1>& c, long double x) {
+                long double p = c[degree];
+                for (size_t k = degree; k > 0; --k) {
+                    p = p * x + c[k - 1];
+                }
+                return static_cast<long double>(F {}(x)) - p;
+            }
+
+            // gaussian elimination with partial pivoting on the (n + 1) x (n + 1) system of the reference
+            static constexpr std::array<long double, degree + 1> solve(const std::array<long double, m>& ref) {
+                std::array<std::array<long double, m + 1>, m> M {};
+                for (size_t i = 0; i < m; ++i) {
+                    for (size_t j = 0; j < n; ++j) {
+                        long double xk = 1.0L;
+                        for (size_t k = 0; k < exponents[j]; ++k) {
+                            xk *= ref[i];
+                        }
+                        M[i][j] = xk;
+                    }
+                    M[i][n] = (i & 1) ? -1.0L : 1.0L;
+                    M[i][m] = static_cast<long double>(F {}(ref[i]));
+                }
+                for (size_t col = 0; col < m; ++col) {
+                    size_t pivot = col;
+                    for (size_t r = col + 1; r < m; ++r) {
+                        if (abs(M[r][col]) > abs(M[pivot][col])) {
+                            pivot = r;
+                        }
+                    }
+                    std::swap(M[col], M[pivot]);
+                    for (size_t r = col + 1; r < m; ++r) {
+                        const long double factor = M[r][col] / M[col][col];
+                        for (size_t k = col; k <= m; ++k) {
+                            M[r][k] -= factor * M[col][k];
+                        }
+                    }
+                }
+                std::array<long double, m> sol {};
+                for (size_t i = m; i-- > 0;) {
+                    long double acc = M[i][m];
+                    for (size_t k = i + 1; k < m; ++k) {
+                        acc -= M[i][k] * sol[k];
+                    }
+                    sol[i] = acc / M[i][i];
+                }
+                std::array<long double, degree + 1> c {};
+                for (size_t j = 0; j < n; ++j) {
+                    c[exponents[j]] = sol[j];
+                }
+                return c;
+            }
+
+            static constexpr result_t compute() {
+                constexpr long double pi = 3.141592653589793238462643383279502884L;
+                // initial reference : chebyshev nodes (interior, so that odd monomials never vanish on it)
+                std::array<long double, m> ref {};
+                for (size_t i = 0; i < m; ++i) {
+                    ref[i] = (a + b) / 2 - (b - a) / 2 * constexpr_cos(pi * (static_cast<long double>(i) + 0.5L) / m);
+                }
+                std::array<long double, degree + 1> c = solve(ref);
+                long double max_error = 0.0L;
+                for (size_t iteration = 0; iteration < max_iterations; ++iteration) {
+                    std::array<long double, grid> xs {}, es {};
+                    size_t count = 0;
+                    max_error = 0.0L;
+                    for (size_t g = 0; g < grid; ++g) {
+                        const long double x = a + (b - a) * static_cast<long double>(g) / (grid - 1);
+                        const long double e = error_at(c, x);
+                        max_error = abs(e) > max_error ? abs(e) : max_error;
+                        if (e == 0.0L) {
+                            continue;
+                        }
+                        if (count > 0 && (es[count - 1] > 0) == (e > 0)) {
+                            if (abs(e) > abs(es[count - 1])) {
+                                xs[count - 1] = x;
+                                es[count - 1] = e;
+                            }
+                        } else {
+                            xs[count] = x;
+                            es[count] = e;
+                            count += 1;
+                        }
+                    }
+                    // keep m consecutive alternating extrema, dropping the smallest at either end
+                    size_t first = 0;
+                    while (count > m) {
+                        if (abs(es[first]) < abs(es[first + count - 1])) {
+                            first += 1;
+                        }
+                        count -= 1;
+                    }
+                    const long double levelled = abs(error_at(c, ref[0]));
+                    if (count < m || max_error - levelled <= 1E-6L * max_error) {
+                        break;
+                    }
+                    // the extrema are only known up to the grid step : once the reference stops moving,
+                    // further iterations would solve the same system again
+                    bool moved = false;
+                    for (size_t i = 0; i < m; ++i) {
+                        moved = moved || ref[i] != xs[first + i];
+                        ref[i] = xs[first + i];
+                    }
+                    if (!moved) {
+                        break;
+                    }
+                    c = solve(ref);
+                }
+                return {c, max_error};
+            }
+
+         public:
+            static constexpr result_t value = compute();
+        };
 
-        /// @brief All One polynomials
-        ///
-        /// Lives in polynomial<I> with all coefficients at 1
+        /// @brief closest fraction to x whose numerator and denominator fit in Integers, with the smallest
+        /// denominator reaching relative precision eps (continued fraction convergents)
         ///
-        /// @tparam I Ring for coefficients defaults to aerobus::i64
-        /// @tparam deg degree of polynomial
-        template<size_t deg, typename I = aerobus::i64>
-        using allone = typename internal::AllOneHelper<deg, I>::type;
+        /// same rounding as find_rational in src/sollya/script.sollya
+        template<typename Integers>
+        static constexpr std::array<typename Integers::inner_type, 2> find_rational(long double x, long double eps) {
+            using inner_type = typename Integers::inner_type;
+            constexpr long double max = static_cast<long double>(std::numeric_limits<inner_type>::max());
+            const long double ax = x < 0 ? -x : x;
+            std::array<inner_type, 2> best = {0, 1};
+            long double h = 1.0L, h_prev = 0.0L, k = 0.0L, k_prev = 1.0L, r = ax;
+            for (int i = 0; i < 64; ++i) {
+                if (r > max) {
+                    break;
+                }
+                const long double q = static_cast<long double>(static_cast<int64_t>(r));
+                const long double h_next = q * h + h_prev;
+                const long double k_next = q * k + k_prev;
+                if (h_next > max || k_next > max) {
+                    break;
+                }
+                h_prev = h;
+                k_prev = k;
+                h = h_next;
+                k = k_next;
+                best = {static_cast<inner_type>(x < 0 ? -h : h), static_cast<inner_type>(k)};
+                const long double err = h / k - ax;
+                if ((err < 0 ? -err : err) <= eps * ax || r == q) {
+                    break;
+                }
+                r = 1.0L / (r - q);
+            }
+            return best;
+        }
 
-        /// @brief Bessel polynomials
-        ///
-        /// Lives in aerobus::polynomial<I>
-        /// @see [See in Wikipedia](https://en.wikipedia.org/wiki/Bessel_polynomials)
-        ///
-        /// @tparam I ring for coefficients, defaults to aerobus::i64
-        /// @tparam deg degree of polynomial
-        template<size_t deg, typename I = aerobus::i64>
-        using bessel = typename internal::BesselHelper<deg, I>::type;
+        template<typename Q, typename R, typename I>
+        struct remez_polynomial;
 
-        /// @brief Touchar polynomials
-        ///
-        /// Lives in aerobus::polynomial<I>
-        /// @see [See in Wikipedia](https://en.wikipedia.org/wiki/Touchard_polynomials)
-        ///
-        /// @tparam I ring for coefficients, defaults to aerobus::i64
-        /// @tparam deg degree of polynomial
-        template<size_t deg, typename I = aerobus::i64>
-        using touchard = taylor<I, internal::touchard_coeff<deg>::template inner, deg>;
-    }  // namespace known_polynomials
+        template<typename Q, typename R, size_t... I>
+        struct remez_polynomial<Q, R, std::index_sequence<I...>> {
+         private:
+            using Integers = typename Q::ring_type;
+            // rounding precision : float for 32 bits rationals, double for 64 bits ones
+            static constexpr long double eps = sizeof(typename Integers::inner_type) <= 4 ?
+                std::numeric_limits<float>::epsilon() / 2 :
+                std::numeric_limits<double>::epsilon() / 2;
+
+            template<size_t i>
+            static constexpr auto fraction = find_rational<Integers>(R::value.coefficients[i], eps);
+
+            template<size_t i>
+            using coeff = typename Q::template simplify_t<typename Q::template val<
+                typename Integers::template inject_constant_t<fraction<i>[0]>,
+                typename Integers::template inject_constant_t<fraction<i>[1]>>>;
+
+         public:
+            using type = typename polynomial<Q>::template simplify_t<
+                typename polynomial<Q>::template val<coeff<I>...>>;
+        };
+
+        template<typename Q, typename F, typename A, typename B, typename I>
+        struct remez_dense;
+
+        template<typename Q, typename F, typename A, typename B, size_t... K>
+        struct remez_dense<Q, F, A, B, std::index_sequence<K...>> {
+            using type = typename remez_polynomial<Q, remez<F, A, B, K...>,
+                make_index_sequence_reverse<sizeof...(K)>>::type;
+        };
+    }  // namespace internal
+
+    /// @brief minimax polynomial of F on [A, B] restricted to the given monomials, computed at compile time
+    ///
+    /// remez exchange algorithm in long double, then each coefficient is rounded to the simplest fraction
+    /// fitting in Q's integers (with float precision for q32, double precision for q64),
+    /// as src/sollya/script.sollya does offline. Example, odd polynomial for sin on [0, pi/4] :
+    /// \code
+    /// constexpr auto f = [](auto x) { return aerobus::sin<aerobus::i64, 19>::eval(x); };
+    /// using S = aerobus::remez_monomials_t<aerobus::q64, decltype(f), aerobus::make_q64_t<0, 1>,
+    ///                                      aerobus::make_q64_t<7853981633974483, 10000000000000000>, 1, 3, 5, 7>;
+    /// \endcode
+    /// @tparam Q rationals (q32 or q64)
+    /// @tparam F default constructible callable (e.g. a lambda without capture), invoked on long double
+    /// in constant evaluation
+    /// @tparam A lower bound of interval (any value exposing get, such as make_q64_t<-1, 1>)
+    /// @tparam B upper bound of interval
+    /// @tparam monomials exponents of the monomials, in increasing order (0 must not be inside [A, B] unless
+    /// all exponents from 0 to the degree are present)
+    template<typename Q, typename F, typename A, typename B, size_t... monomials>
+    using remez_monomials_t = typename internal::remez_polynomial<Q, internal::remez<F, A, B, monomials...>,
+        internal::make_index_sequence_reverse<std::max({monomials...}) + 1>>::type;
+
+    /// @brief minimax polynomial of degree deg of F on [A, B], computed at compile time
+    ///
+    /// see remez_monomials_t
+    /// @tparam Q rationals (q32 or q64)
+    /// @tparam F default constructible callable, invoked on long double in constant evaluation
+    /// @tparam A lower bound of interval
+    /// @tparam B upper bound of interval
+    /// @tparam deg degree
+    template<typename Q, typename F, typename A, typename B, size_t deg>
+    using remez_t = typename internal::remez_dense<Q, F, A, B, std::make_index_sequence<deg + 1>>::type;
 }  // namespace aerobus
 
 // libm
 namespace aerobus {
     namespace libm {
+        /// @brief accuracy tiers of libm functions, given as last template parameter (e.g. sin<float, accuracy::ulp4>)
+        ///
+        /// a tier selects the polynomial degree, the precision of the range reduction
+        /// and whether special cases (huge arguments, infinities) are handled
+        namespace accuracy {
+            /// @brief within about one ulp : full degree polynomials, reduction in upper_type, all special cases
+            struct ulp1 {
+                /// @brief number of parts of pi/2 in SIMD Cody-Waite reduction
+                static constexpr size_t cody_waite_parts = 4;
+                /// @brief types without SIMD kernels (__half) reduce in arithmetic_helpers<T>::upper_type
+                static constexpr bool upper_reduction = true;
+                /// @brief huge arguments go through Payne-Hanek reduction
+                static constexpr bool special_cases = true;
+                /// @brief the reduced argument is kept as hi + lo, and the polynomial step adds lo back
+                static constexpr bool compensated_reduction = true;
+            };
+
+            /// @brief within a few ulps : lower degree polynomials, scalar reduction in T
+            struct ulp4 {
+                static constexpr size_t cody_waite_parts = 4;
+                static constexpr bool upper_reduction = false;
+                static constexpr bool special_cases = true;
+                static constexpr bool compensated_reduction = false;
+            };
+
+            /// @brief error below 1E-4 (absolute for sin and cos) : tiny polynomials, pi/2 in two parts,
+            /// arguments must be finite and below cody_waite<T>::threshold (2^20 for double, 2^12 for float)
+            struct approx_1e4 {
+                static constexpr size_t cody_waite_parts = 2;
+                static constexpr bool upper_reduction = false;
+                static constexpr bool special_cases = false;
+                static constexpr bool compensated_reduction = false;
+            };
+        }  // namespace accuracy
+
         namespace internal {
-            // template<typename T>
-            // struct exp2_poly;
-
-            // template<>
-            // struct exp2_poly<double> {
-            //     using type = aerobus::polynomial<aerobus::q64>::template val<
-            //         aerobus::make_q64_t<388, 10641171255427>,
-            //         aerobus::make_q64_t<2296, 5579977897299>,
-            //         aerobus::make_q64_t<4963, 697799188641>,
-            //         aerobus::make_q64_t<15551, 152884735543>,
-            //         aerobus::make_q64_t<21273, 16096444733>,
-            //         aerobus::make_q64_t<683500, 44811710339>,
-            //         aerobus::make_q64_t<44397656049575, 288230376151711744>,
-            //         aerobus::make_q64_t<192156823709857, 144115188075855872>,
-            //         aerobus::make_q64_t<693059242663871, 72057594037927936>,
-            //         aerobus::make_q64_t<1999746264802375, 36028797018963968>,
-            //         aerobus::make_q64_t<4327536028902111, 18014398509481984>,
-            //         aerobus::make_q64_t<6243314768165359, 9007199254740992>,
-            //         aerobus::q64::one>;
-            // };
-
-            // template<>
-            // struct exp2_poly<float> {
-            //     using type = aerobus::polynomial<aerobus::q32>::template val<
-            //         aerobus::make_q32_t<8, 375115>,
-            //         aerobus::make_q32_t<30, 208117>,
-            //         aerobus::make_q32_t<109, 81261>,
-            //         aerobus::make_q32_t<5161841, 536870912>,
-            //         aerobus::make_q32_t<3724869, 67108864>,
-            //         aerobus::make_q32_t<16121323, 67108864>,
-            //         aerobus::make_q32_t<1453635, 2097152>,
-            //         aerobus::q32::one>;
-            // };
-
-            // #ifdef WITH_CUDA_FP16
-            // template<>
-            // struct exp2_poly<__half> {
-            //     using type = aerobus::polynomial<aerobus::q16>::template val<
-            //         aerobus::make_q16_t<3, 212>,
-            //         aerobus::make_q16_t<13, 256>,
-            //         aerobus::make_q16_t<31, 128>,
-            //         aerobus::make_q16_t<1419, 2048>,
-            //         aerobus::q16::one>;
-            // };
-
-            // template<>
-            // struct exp2_poly<__half2> {
-            //     using type = aerobus::polynomial<aerobus::q16>::template val<
-            //         aerobus::make_q16_t<3, 212>,
-            //         aerobus::make_q16_t<13, 256>,
-            //         aerobus::make_q16_t<31, 128>,
-            //         aerobus::make_q16_t<1419, 2048>,
-            //         aerobus::q16::one>;
-            // };
-            // #endif
+            template<typename T>
+            struct exp2_poly;
 
-            template<typename P>
+            template<>
+            struct exp2_poly<double> {
+                // approximates 2^x over [0, 1]
+                using type = aerobus::polynomial<aerobus::q64>::template val<
+                    aerobus::make_q64_t<388, 10641171255427>,
+                    aerobus::make_q64_t<2296, 5579977897299>,
+                    aerobus::make_q64_t<4963, 697799188641>,
+                    aerobus::make_q64_t<15551, 152884735543>,
+                    aerobus::make_q64_t<21273, 16096444733>,
+                    aerobus::make_q64_t<683500, 44811710339>,
+                    aerobus::make_q64_t<44397656049575, 288230376151711744>,
+                    aerobus::make_q64_t<192156823709857, 144115188075855872>,
+                    aerobus::make_q64_t<693059242663871, 72057594037927936>,
+                    aerobus::make_q64_t<1999746264802375, 36028797018963968>,
+                    aerobus::make_q64_t<4327536028902111, 18014398509481984>,
+                    aerobus::make_q64_t<6243314768165359, 9007199254740992>,
+                    aerobus::q64::one>;
+            };
+
+            template<>
+            struct exp2_poly<float> {
+                // approximates 2^x over [0, 1]
+                using type = aerobus::polynomial<aerobus::q32>::template val<
+                    aerobus::make_q32_t<8, 375115>,
+                    aerobus::make_q32_t<30, 208117>,
+                    aerobus::make_q32_t<109, 81261>,
+                    aerobus::make_q32_t<5161841, 536870912>,
+                    aerobus::make_q32_t<3724869, 67108864>,
+                    aerobus::make_q32_t<16121323, 67108864>,
+                    aerobus::make_q32_t<1453635, 2097152>,
+                    aerobus::q32::one>;
+            };
+
+            #ifdef WITH_CUDA_FP16
+            template<>
+            struct exp2_poly<__half> {
+                using type = aerobus::polynomial<aerobus::q16>::template val<
+                    aerobus::make_q16_t<3, 212>,
+                    aerobus::make_q16_t<13, 256>,
+                    aerobus::make_q16_t<31, 128>,
+                    aerobus::make_q16_t<1419, 2048>,
+                    aerobus::q16::one>;
+            };
+
+            template<>
+            struct exp2_poly<__half2> {
+                using type = aerobus::polynomial<aerobus::q16>::template val<
+                    aerobus::make_q16_t<3, 212>,
+                    aerobus::make_q16_t<13, 256>,
+                    aerobus::make_q16_t<31, 128>,
+                    aerobus::make_q16_t<1419, 2048>,
+                    aerobus::q16::one>;
+            };
+            #endif
+
+            template<typename T>
+            struct log_poly;
+
+            // log(1+f) = 2 atanh(s) = 2s + s * s^2 * Q(s^2), where s = f / (2 + f)
+            template<>
+            struct log_poly<double> {
+                // approximates (2 atanh(s)/s - 2) / s^2 in s^2 over [0, 0.0295] with relative precision 4.66e-16
+                // remez_t<q64, F, 0, 0.0295, 6> (absolute error), see TEST(libm, polynomial_tables)
+                using type = aerobus::polynomial<aerobus::q64>::template val<
+                    aerobus::make_q64_t<33900787, 231869581>,
+                    aerobus::make_q64_t<34055053, 222126561>,
+                    aerobus::make_q64_t<30235327, 166284405>,
+                    aerobus::make_q64_t<29870102, 134415527>,
+                    aerobus::make_q64_t<73489157, 257212049>,
+                    aerobus::make_q64_t<77807686635, 194519216588>,
+                    aerobus::make_q64_t<715211851493081, 1072817777239621>>;
+            };
+
+            template<>
+            struct log_poly<float> {
+                // approximates (2 atanh(s)/s - 2) / s^2 in s^2 over [0, 0.0295] with relative precision 2.81e-7
+                // remez_t<q32, F, 0, 0.0295, 2> (absolute error), see TEST(libm, polynomial_tables)
+                using type = aerobus::polynomial<aerobus::q32>::template val<
+                    aerobus::make_q32_t<1715, 5797>,
+                    aerobus::make_q32_t<1412, 3531>,
+                    aerobus::make_q32_t<1187059, 1780588>>;
+            };
+
+            template<typename T>
+            struct atan_poly;
+
+            // atan(t) = t + t * t^2 * Q(t^2)
+            template<>
+            struct atan_poly<double> {
+                // approximates (atan(t)/t - 1) / t^2 in t^2 over [0, tan(pi/8)^2] with relative precision 1.95e-16
+                // remez_t<q64, F, 0, tan(pi/8)^2, 10> (absolute error), see TEST(libm, polynomial_tables)
+                using type = aerobus::polynomial<aerobus::q64>::template val<
+                    aerobus::make_q64_t<-29972672, 1558810205>,
+                    aerobus::make_q64_t<21390095, 544617322>,
+                    aerobus::make_q64_t<-15495705, 304610966>,
+                    aerobus::make_q64_t<40800576, 696437197>,
+                    aerobus::make_q64_t<-20485321, 307377368>,
+                    aerobus::make_q64_t<20528009, 266868333>,
+                    aerobus::make_q64_t<-42118070, 463298993>,
+                    aerobus::make_q64_t<13385721, 120471490>,
+                    aerobus::make_q64_t<-2042806734, 14299647139>,
+                    aerobus::make_q64_t<946740383818, 4733701919091>,
+                    aerobus::make_q64_t<-1, 3>>;
+            };
+
+            template<>
+            struct atan_poly<float> {
+                // approximates (atan(t)/t - 1) / t^2 in t^2 over [0, tan(pi/8)^2] with relative precision 9.76e-8
+                // remez_t<q32, F, 0, tan(pi/8)^2, 4> (absolute error), see TEST(libm, polynomial_tables)
+                using type = aerobus::polynomial<aerobus::q32>::template val<
+                    aerobus::make_q32_t<-658, 10175>,
+                    aerobus::make_q32_t<1810, 16839>,
+                    aerobus::make_q32_t<-1057, 7410>,
+                    aerobus::make_q32_t<9080, 45401>,
+                    aerobus::make_q32_t<-1, 3>>;
+            };
+
+            template<typename T>
+            struct asin_poly;
+
+            // asin(s) = s + s * s^2 * R(s^2)
+            template<>
+            struct asin_poly<double> {
+                // approximates (asin(s)/s - 1) / s^2 in s^2 over [0, 1/4] with relative precision 1.59e-16
+                // remez_t<q64, F, 0, 1/4, 12> (absolute error), see TEST(libm, polynomial_tables)
+                using type = aerobus::polynomial<aerobus::q64>::template val<
+                    aerobus::make_q64_t<24459320, 843386447>,
+                    aerobus::make_q64_t<-34713982, 2281317131>,
+                    aerobus::make_q64_t<14312231, 811354234>,
+                    aerobus::make_q64_t<26559997, 4948280969>,
+                    aerobus::make_q64_t<5959611, 576125525>,
+                    aerobus::make_q64_t<65214941, 5682827015>,
+                    aerobus::make_q64_t<37051204, 2651900041>,
+                    aerobus::make_q64_t<13069607, 753188667>,
+                    aerobus::make_q64_t<10308559, 460775917>,
+                    aerobus::make_q64_t<9401623, 309447709>,
+                    aerobus::make_q64_t<102976623, 2306676355>,
+                    aerobus::make_q64_t<106435856963, 1419144759507>,
+                    aerobus::make_q64_t<1, 6>>;
+            };
+
+            template<>
+            struct asin_poly<float> {
+                // approximates (asin(s)/s - 1) / s^2 in s^2 over [0, 1/4] with relative precision 3.88e-7
+                // remez_t<q32, F, 0, 1/4, 4> (absolute error), see TEST(libm, polynomial_tables)
+                using type = aerobus::polynomial<aerobus::q32>::template val<
+                    aerobus::make_q32_t<509, 13280>,
+                    aerobus::make_q32_t<71, 2686>,
+                    aerobus::make_q32_t<245, 5442>,
+                    aerobus::make_q32_t<757, 10095>,
+                    aerobus::make_q32_t<429379, 2576273>>;
+            };
+
+            template<typename T, typename Accuracy = accuracy::ulp1>
             struct sin_poly;
 
             template<>
@@ -4428,29 +7260,17 @@ namespace aerobus {
                 using type = typename aerobus::polynomial<aerobus::q32>::simplify_t<
                     typename aerobus::polynomial<aerobus::q32>:: template val<
                         aerobus::make_q32_t<14858575, 1073741824>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<-14207751, 268435456>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<11935291, 134217728>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<-11575033, 134217728>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<1790113, 33554432>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<-5893293, 268435456>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<3264339, 536870912>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<-40, 35687>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<50, 368859>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<-63, 303103>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<4474113, 536870912>,
-                        aerobus::q32::zero,
                         aerobus::make_q32_t<-11184811, 67108864>,
-                        aerobus::q32::zero,
                         aerobus::q32::one>>;
             };
 
@@ -4478,7 +7298,52 @@ namespace aerobus {
             };
             #endif
 
-            template<typename T>
+            template<>
+            struct sin_poly<double, accuracy::ulp4> {
+                // approximates sin(x)/x over [-pi/4, pi/4] with relative precision 3.6e-18
+                // must be evaluated in x*x
+                using type = aerobus::polynomial<aerobus::q64>::template val<
+                    aerobus::make_q64_t<744118, 4681097774569063>,
+                    aerobus::make_q64_t<-161692837, 6454611203885098>,
+                    aerobus::make_q64_t<12453440503, 4519105408522730>,
+                    aerobus::make_q64_t<-1528267561393, 7702468513955247>,
+                    aerobus::make_q64_t<300239975157629, 36028797018963968>,
+                    aerobus::make_q64_t<-750599937895081, 4503599627370496>,
+                    aerobus::q64::one>;
+            };
+
+            template<>
+            struct sin_poly<float, accuracy::ulp4> {
+                // approximates sin(x)/x over [-pi/4, pi/4] with relative precision 3.8e-9
+                // must be evaluated in x*x
+                using type = aerobus::polynomial<aerobus::q32>::template val<
+                    aerobus::make_q32_t<-2495, 12784854>,
+                    aerobus::make_q32_t<8946589, 1073741824>,
+                    aerobus::make_q32_t<-11184803, 67108864>,
+                    aerobus::q32::one>;
+            };
+
+            template<>
+            struct sin_poly<double, accuracy::approx_1e4> {
+                // approximates sin(x)/x over [-pi/4, pi/4] with relative precision 1.9e-6
+                // must be evaluated in x*x
+                using type = aerobus::polynomial<aerobus::q64>::template val<
+                    aerobus::make_q64_t<4705810659063863, 576460752303423488>,
+                    aerobus::make_q64_t<-3001809535907111, 18014398509481984>,
+                    aerobus::q64::one>;
+            };
+
+            template<>
+            struct sin_poly<float, accuracy::approx_1e4> {
+                // approximates sin(x)/x over [-pi/4, pi/4] with relative precision 1.9e-6
+                // must be evaluated in x*x
+                using type = aerobus::polynomial<aerobus::q32>::template val<
+                    aerobus::make_q32_t<8765255, 1073741824>,
+                    aerobus::make_q32_t<-2795653, 16777216>,
+                    aerobus::q32::one>;
+            };
+
+            template<typename T, typename Accuracy = accuracy::ulp1>
             struct cos_poly;
 
             template <>
@@ -4511,81 +7376,891 @@ namespace aerobus {
                         aerobus::make_q32_t<-1, 2>>>;
             };
 
-#ifdef WITH_CUDA_FP16
-            template<>
-            struct cos_poly<__half> {
-                // approximates (cos(x) - 1)/x^2
-                // must be evaluated in x*x as we removed half the coefficients to have a dense polynomial
-                using type = typename aerobus::polynomial<aerobus::q16>::simplify_t<
-                    typename aerobus::polynomial<aerobus::q16>:: template val<
-                        aerobus::make_q16_t<-1, 1589>,
-                        aerobus::make_q16_t<1, 992>,
-                        aerobus::make_q16_t<-1, 1821>,
-                        aerobus::make_q16_t<-1, 795>,
-                        aerobus::make_q16_t<1, 24>,
-                        aerobus::make_q16_t<-1, 2>>>;
+#ifdef WITH_CUDA_FP16
+            template<>
+            struct cos_poly<__half> {
+                // approximates (cos(x) - 1)/x^2
+                // must be evaluated in x*x as we removed half the coefficients to have a dense polynomial
+                using type = typename aerobus::polynomial<aerobus::q16>::simplify_t<
+                    typename aerobus::polynomial<aerobus::q16>:: template val<
+                        aerobus::make_q16_t<-1, 1589>,
+                        aerobus::make_q16_t<1, 992>,
+                        aerobus::make_q16_t<-1, 1821>,
+                        aerobus::make_q16_t<-1, 795>,
+                        aerobus::make_q16_t<1, 24>,
+                        aerobus::make_q16_t<-1, 2>>>;
+            };
+
+            template<>
+            struct cos_poly<__half2> {
+                // approximates (cos(x) - 1)/x^2
+                // must be evaluated in x*x as we removed half the coefficients to have a dense polynomial
+                using type = typename aerobus::polynomial<aerobus::q16>::simplify_t<
+                    typename aerobus::polynomial<aerobus::q16>:: template val<
+                        aerobus::make_q16_t<-1, 1589>,
+                        aerobus::make_q16_t<1, 992>,
+                        aerobus::make_q16_t<-1, 1821>,
+                        aerobus::make_q16_t<-1, 795>,
+                        aerobus::make_q16_t<1, 24>,
+                        aerobus::make_q16_t<-1, 2>>>;
+            };
+            #endif
+
+            template<>
+            struct cos_poly<double, accuracy::ulp4> {
+                // approximates (cos(x) - 1)/x^2 over [-pi/4, pi/4], cos with relative precision 6.1e-17
+                // must be evaluated in x*x
+                using type = aerobus::polynomial<aerobus::q64>::template val<
+                    aerobus::make_q64_t<6622142, 3209858711198359>,
+                    aerobus::make_q64_t<-267414968, 970468575232539>,
+                    aerobus::make_q64_t<123914928677, 4996251667292951>,
+                    aerobus::make_q64_t<-6405119461599603, 4611686018427387904>,
+                    aerobus::make_q64_t<6004799503134889, 144115188075855872>,
+                    aerobus::make_q64_t<-4503599627370443, 9007199254740992>>;
+            };
+
+            template<>
+            struct cos_poly<float, accuracy::ulp4> {
+                // approximates (cos(x) - 1)/x^2 over [-pi/4, pi/4], cos with relative precision 3.8e-8
+                // must be evaluated in x*x
+                using type = aerobus::polynomial<aerobus::q32>::template val<
+                    aerobus::make_q32_t<-17349, 12764266>,
+                    aerobus::make_q32_t<11181887, 268435456>,
+                    aerobus::make_q32_t<-16777177, 33554432>>;
+            };
+
+            template<>
+            struct cos_poly<double, accuracy::approx_1e4> {
+                // approximates (cos(x) - 1)/x^2 over [-pi/4, pi/4], cos with relative precision 1.5e-5
+                // must be evaluated in x*x
+                using type = aerobus::polynomial<aerobus::q64>::template val<
+                    aerobus::make_q64_t<728834461141309, 18014398509481984>,
+                    aerobus::make_q64_t<-9002885745945231, 18014398509481984>>;
+            };
+
+            template<>
+            struct cos_poly<float, accuracy::approx_1e4> {
+                // approximates (cos(x) - 1)/x^2 over [-pi/4, pi/4], cos with relative precision 1.5e-5
+                // must be evaluated in x*x
+                using type = aerobus::polynomial<aerobus::q32>::template val<
+                    aerobus::make_q32_t<169695, 4194304>,
+                    aerobus::make_q32_t<-16769181, 33554432>>;
+            };
+
+            template<typename T>
+            struct cody_waite;
+
+            // pi/2 is split so that k * pio2_1, k * pio2_2 and k * pio2_3 are exact as long as |x| < threshold
+            template<>
+            struct cody_waite<double> {
+                static constexpr double two_over_pi = 0x1.45f306dc9c883p-1;
+                // 33 bits each
+                static constexpr double pio2_1 = 0x1.921fb544p0;
+                static constexpr double pio2_2 = 0x1.0b4611a6p-34;
+                static constexpr double pio2_3 = 0x1.3198a2ep-69;
+                static constexpr double pio2_4 = 0x1.b839a252049c1p-104;
+                // pio2_2 + pio2_3 + pio2_4, for the two parts reduction
+                static constexpr double pio2_2_tail = pio2_2 + (pio2_3 + pio2_4);
+                // k < 2^20
+                static constexpr double threshold = 0x1p20;
+                static constexpr int sign_bit = 63;
+            };
+
+            template<>
+            struct cody_waite<float> {
+                static constexpr float two_over_pi = 0x1.45f306p-1f;
+                // 12 bits each
+                static constexpr float pio2_1 = 0x1.92p0f;
+                static constexpr float pio2_2 = 0x1.fb4p-12f;
+                static constexpr float pio2_3 = 0x1.444p-24f;
+                static constexpr float pio2_4 = 0x1.68c234p-39f;
+                // pio2_2 + pio2_3 + pio2_4, for the two parts reduction
+                static constexpr float pio2_2_tail = pio2_2 + (pio2_3 + pio2_4);
+                // k < 2^12
+                static constexpr float threshold = 0x1p12f;
+                static constexpr int sign_bit = 31;
+            };
+
+            template<typename T, typename Accuracy = accuracy::ulp1>
+            struct fast_sin_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using poly = typename sin_poly<T, Accuracy>::type;
+                    return Lane::mul(x, aerobus::internal::lane_horner<Lane, poly>::func(Lane::mul(x, x)));
+                }
+            };
+
+            template<typename T, typename Accuracy = accuracy::ulp1>
+            struct fast_cos_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using poly = typename cos_poly<T, Accuracy>::type;
+                    const typename Lane::type x2 = Lane::mul(x, x);
+                    return Lane::fma(
+                        x2,
+                        aerobus::internal::lane_horner<Lane, poly>::func(x2),
+                        Lane::broadcast(aerobus::arithmetic_helpers<T>::one()));
+                }
+            };
+
+            template<typename T>
+            struct exp_constants;
+
+            template<>
+            struct exp_constants<double> {
+                // log2(e) = log2e + log2e_lo
+                static constexpr double log2e = 0x1.71547652b82fep0;
+                static constexpr double log2e_lo = 0x1.777d0ffda0d24p-56;
+                // inputs are clamped there, far enough for results to be 0 or inf
+                static constexpr double exp2_min = -1080.0;
+                static constexpr double exp2_max = 1030.0;
+                static constexpr double exp_min = -750.0;
+                static constexpr double exp_max = 714.5;
+                // expm1(x) rounds to -1 below
+                static constexpr double expm1_min = -40.0;
+                // expm1(x) rounds to x below
+                static constexpr double expm1_tiny = 0x1p-54;
+                static constexpr int bias = 1023;
+            };
+
+            template<>
+            struct exp_constants<float> {
+                static constexpr float log2e = 0x1.715476p0f;
+                static constexpr float log2e_lo = 0x1.4ae0c0p-26f;
+                static constexpr float exp2_min = -160.0f;
+                static constexpr float exp2_max = 130.0f;
+                static constexpr float exp_min = -111.0f;
+                static constexpr float exp_max = 90.0f;
+                static constexpr float expm1_min = -20.0f;
+                static constexpr float expm1_tiny = 0x1p-25f;
+                static constexpr int bias = 127;
+            };
+
+            /// @brief 2^j for integral j in normal exponent range, built directly from bits
+            template<typename T, typename Lane>
+            static INLINED typename Lane::type pow2_lane(const typename Lane::type j) {
+                using ibits = typename Lane::ibits;
+                constexpr int mantissa = aerobus::internal::FloatLayout<T>::mantissa;
+                constexpr T magic = static_cast<T>(3) * static_cast<T>(1ULL << (mantissa - 1));
+                // j lives in the low bits of mantissa once magic is added
+                constexpr ibits offset = static_cast<ibits>(exp_constants<T>::bias) - std::bit_cast<ibits>(magic);
+                return Lane::from_bits(Lane::template shl<mantissa>(
+                    Lane::iadd(Lane::as_bits(Lane::add(j, Lane::broadcast(magic))), Lane::ibroadcast(offset))));
+            }
+
+            /// @brief p * 2^k, in two steps so that k may exceed exponent range (overflow, denormals)
+            template<typename T, typename Lane>
+            static INLINED typename Lane::type ldexp_lane(const typename Lane::type p, const typename Lane::type k) {
+                const typename Lane::type k1 = Lane::floor(Lane::mul(k, Lane::broadcast(static_cast<T>(0.5))));
+                const typename Lane::type k2 = Lane::sub(k, k1);
+                return Lane::mul(Lane::mul(p, pow2_lane<T, Lane>(k1)), pow2_lane<T, Lane>(k2));
+            }
+
+            /// @brief x * log2(e) as a double-T hi + lo
+            template<typename T, typename Lane>
+            static INLINED void mul_log2e(
+                    const typename Lane::type x, typename Lane::type *hi, typename Lane::type *lo) {
+                Lane::two_prod(x, Lane::broadcast(exp_constants<T>::log2e), hi, lo);
+                *lo = Lane::fma(x, Lane::broadcast(exp_constants<T>::log2e_lo), *lo);
+            }
+
+            /// @brief branchless 2^x on a whole lane : 2^x = 2^floor(x) * P(x - floor(x))
+            /// @tparam T float or double
+            template<typename T>
+            struct exp2_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using C = exp_constants<T>;
+                    using type = typename Lane::type;
+                    // NaN goes through min and max
+                    const type xc = Lane::max(Lane::broadcast(C::exp2_min), Lane::min(Lane::broadcast(C::exp2_max), x));
+                    const type k = Lane::floor(xc);
+                    const type p = aerobus::internal::lane_horner<Lane, typename exp2_poly<T>::type>::func(
+                        Lane::sub(xc, k));
+                    return ldexp_lane<T, Lane>(p, k);
+                }
+            };
+
+            /// @brief branchless e^x on a whole lane
+            ///
+            /// y = x * log2(e) is computed in double-T, then 2^y = 2^floor(y) * P(y - floor(y))
+            /// @tparam T float or double
+            template<typename T>
+            struct exp_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using C = exp_constants<T>;
+                    using type = typename Lane::type;
+                    const type xc = Lane::max(Lane::broadcast(C::exp_min), Lane::min(Lane::broadcast(C::exp_max), x));
+                    type hi, lo;
+                    mul_log2e<T, Lane>(xc, &hi, &lo);
+                    const type k = Lane::floor(hi);
+                    const type p = aerobus::internal::lane_horner<Lane, typename exp2_poly<T>::type>::func(
+                        Lane::add(Lane::sub(hi, k), lo));
+                    return ldexp_lane<T, Lane>(p, k);
+                }
+            };
+
+            /// @brief (P - P(0)) / X, computed on coefficients to avoid rational overflows of long division
+            template<typename P, typename I = std::make_index_sequence<P::degree>>
+            struct drop_constant;
+
+            template<typename P, size_t... i>
+            struct drop_constant<P, std::index_sequence<i...>> {
+                using type = typename P::enclosing_type::template val<
+                    typename P::template coeff_at_t<P::degree - i>...>;
+            };
+
+            /// @brief branchless e^x - 1 on a whole lane
+            ///
+            /// computed on |x| as 2^k * (2^t - 1 + 1 - 2^-k), where 2^t - 1 = t * (P(t) - 1) / t keeps
+            /// full relative precision for small t. Negative inputs use expm1(-a) = -expm1(a) / (1 + expm1(a))
+            /// @tparam T float or double
+            template<typename T>
+            struct expm1_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using C = exp_constants<T>;
+                    using type = typename Lane::type;
+                    // (P - 1) / X, exact since P(0) = 1
+                    using Q = typename drop_constant<typename exp2_poly<T>::type>::type;
+                    const type one = Lane::broadcast(static_cast<T>(1));
+                    const auto neg = Lane::lt(x, Lane::broadcast(static_cast<T>(0)));
+                    const type xa = Lane::select(neg,
+                        Lane::min(Lane::broadcast(-C::expm1_min), Lane::sub(Lane::broadcast(static_cast<T>(0)), x)),
+                        Lane::min(Lane::broadcast(C::exp_max), x));
+                    type hi, lo;
+                    mul_log2e<T, Lane>(xa, &hi, &lo);
+                    const type k = Lane::floor(hi);
+                    const type t = Lane::add(Lane::sub(hi, k), lo);
+                    const type em = Lane::mul(t, aerobus::internal::lane_horner<Lane, Q>::func(t));
+                    // 1 - 2^-k is exact as long as it matters
+                    const type kc = Lane::min(k,
+                        Lane::broadcast(static_cast<T>(aerobus::internal::FloatLayout<T>::mantissa + 8)));
+                    const type s = Lane::sub(one,
+                        pow2_lane<T, Lane>(Lane::sub(Lane::broadcast(static_cast<T>(0)), kc)));
+                    const type e = ldexp_lane<T, Lane>(Lane::add(em, s), k);
+                    type result = Lane::select(neg,
+                        Lane::sub(Lane::broadcast(static_cast<T>(0)), Lane::div(e, Lane::add(one, e))), e);
+                    // keeps denormals (and signed zeros) exact
+                    return Lane::select(Lane::lt(Lane::abs(x), Lane::broadcast(C::expm1_tiny)), x, result);
+                }
+            };
+
+            template<typename T>
+            struct log_constants;
+
+            template<>
+            struct log_constants<double> {
+                // k * ln2_hi is exact for |k| < 2^11
+                static constexpr double ln2_hi = 0x1.62e42feep-1;
+                static constexpr double ln2_lo = 0x1.a39ef35793c76p-33;
+                static constexpr double sqrt2_2 = 0x1.6a09e667f3bcdp-1;
+                // log1p(x) rounds to x below
+                static constexpr double log1p_tiny = 0x1p-54;
+            };
+
+            template<>
+            struct log_constants<float> {
+                static constexpr float ln2_hi = 0x1.62e3p-1f;
+                static constexpr float ln2_lo = 0x1.2fefa2p-17f;
+                static constexpr float sqrt2_2 = 0x1.6a09e6p-1f;
+                static constexpr float log1p_tiny = 0x1p-25f;
+            };
+
+            /// @brief splits positive finite x (denormals included) in 2^e * (1 + f),
+            /// with 1 + f in [sqrt(2)/2, sqrt(2))
+            ///
+            /// exponent and mantissa are read from bits, after an offset which moves the
+            /// mantissa boundary from 1 to sqrt(2)/2
+            template<typename T, typename Lane>
+            static INLINED void log_decompose(
+                    const typename Lane::type x, typename Lane::type *e, typename Lane::type *f) {
+                using type = typename Lane::type;
+                using ibits = typename Lane::ibits;
+                constexpr int mantissa = aerobus::internal::FloatLayout<T>::mantissa;
+                constexpr T scale = static_cast<T>(1ULL << (mantissa + 2));
+                constexpr T magic = static_cast<T>(1ULL << mantissa);
+                constexpr ibits sqrt2_2 = std::bit_cast<ibits>(log_constants<T>::sqrt2_2);
+                constexpr ibits offset = std::bit_cast<ibits>(static_cast<T>(1)) - sqrt2_2;
+                constexpr ibits mantissa_mask = (static_cast<ibits>(1) << mantissa) - 1;
+                const auto denormal = Lane::lt(x, Lane::broadcast(std::numeric_limits<T>::min()));
+                const type xs = Lane::select(denormal, Lane::mul(x, Lane::broadcast(scale)), x);
+                const typename Lane::itype ix = Lane::iadd(Lane::as_bits(xs), Lane::ibroadcast(offset));
+                // biased exponent lives in the low bits of magic mantissa
+                *e = Lane::sub(
+                    Lane::from_bits(Lane::iadd(
+                        Lane::template shr<mantissa>(ix), Lane::ibroadcast(std::bit_cast<ibits>(magic)))),
+                    Lane::broadcast(magic + static_cast<T>(exp_constants<T>::bias)));
+                *e = Lane::sub(*e, Lane::select(denormal,
+                    Lane::broadcast(static_cast<T>(mantissa + 2)), Lane::broadcast(static_cast<T>(0))));
+                *f = Lane::sub(
+                    Lane::from_bits(Lane::iadd(
+                        Lane::iand(ix, Lane::ibroadcast(mantissa_mask)), Lane::ibroadcast(sqrt2_2))),
+                    Lane::broadcast(static_cast<T>(1)));
+            }
+
+            /// @brief log(1 + f) - f, split as hfsq - s * (hfsq + R) so that the caller adds f last
+            template<typename T, typename Lane>
+            static INLINED typename Lane::type log_tail(const typename Lane::type f, typename Lane::type *hfsq) {
+                using type = typename Lane::type;
+                const type s = Lane::div(f, Lane::add(Lane::broadcast(static_cast<T>(2)), f));
+                const type z = Lane::mul(s, s);
+                const type R = Lane::mul(z, aerobus::internal::lane_horner<Lane, typename log_poly<T>::type>::func(z));
+                *hfsq = Lane::mul(Lane::broadcast(static_cast<T>(0.5)), Lane::mul(f, f));
+                return Lane::mul(s, Lane::add(*hfsq, R));
+            }
+
+            /// @brief log of special values : 0, negative, +inf and NaN
+            template<typename T, typename Lane>
+            static INLINED typename Lane::type log_special(const typename Lane::type x, typename Lane::type r) {
+                r = Lane::select(Lane::gt(x, Lane::broadcast(std::numeric_limits<T>::max())), x, r);
+                r = Lane::select(Lane::eq(x, Lane::broadcast(static_cast<T>(0))),
+                    Lane::broadcast(-std::numeric_limits<T>::infinity()), r);
+                r = Lane::select(Lane::lt(x, Lane::broadcast(static_cast<T>(0))),
+                    Lane::broadcast(std::numeric_limits<T>::quiet_NaN()), r);
+                return Lane::select(Lane::eq(x, x), r, x);
+            }
+
+            /// @brief branchless natural logarithm on a whole lane
+            ///
+            /// x = 2^e * (1 + f), log(x) = e * ln(2) + log(1 + f), with log(1 + f) = 2 atanh(f / (2 + f))
+            /// @tparam T float or double
+            template<typename T>
+            struct log_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using C = log_constants<T>;
+                    using type = typename Lane::type;
+                    type e, f, hfsq;
+                    log_decompose<T, Lane>(x, &e, &f);
+                    const type t = log_tail<T, Lane>(f, &hfsq);
+                    // e * ln2_hi - ((hfsq - (t + e * ln2_lo)) - f)
+                    const type r = Lane::fma(e, Lane::broadcast(C::ln2_hi),
+                        Lane::sub(f, Lane::sub(hfsq, Lane::fma(e, Lane::broadcast(C::ln2_lo), t))));
+                    return log_special<T, Lane>(x, r);
+                }
+            };
+
+            /// @brief branchless base 2 logarithm on a whole lane
+            /// @tparam T float or double
+            template<typename T>
+            struct log2_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using type = typename Lane::type;
+                    type e, f, hfsq;
+                    log_decompose<T, Lane>(x, &e, &f);
+                    const type t = log_tail<T, Lane>(f, &hfsq);
+                    const type l = Lane::sub(f, Lane::sub(hfsq, t));
+                    // e + l * log2(e), with log2(e) in two parts
+                    const type r = Lane::fma(l, Lane::broadcast(exp_constants<T>::log2e),
+                        Lane::fma(l, Lane::broadcast(exp_constants<T>::log2e_lo), e));
+                    return log_special<T, Lane>(x, r);
+                }
+            };
+
+            /// @brief branchless log(1 + x) on a whole lane
+            ///
+            /// u = 1 + x is decomposed as in log, and the rounding error of u is added back as (x - (u - 1)) / u
+            /// @tparam T float or double
+            template<typename T>
+            struct log1p_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using C = log_constants<T>;
+                    using type = typename Lane::type;
+                    const type one = Lane::broadcast(static_cast<T>(1));
+                    const type u = Lane::add(one, x);
+                    const type c = Lane::div(Lane::sub(x, Lane::sub(u, one)), u);
+                    type e, f, hfsq;
+                    log_decompose<T, Lane>(u, &e, &f);
+                    const type t = log_tail<T, Lane>(f, &hfsq);
+                    const type r = Lane::fma(e, Lane::broadcast(C::ln2_hi),
+                        Lane::sub(f, Lane::sub(hfsq, Lane::add(Lane::fma(e, Lane::broadcast(C::ln2_lo), c), t))));
+                    // keeps denormals (and signed zeros) exact
+                    return Lane::select(Lane::lt(Lane::abs(x), Lane::broadcast(C::log1p_tiny)), x,
+                        log_special<T, Lane>(u, r));
+                }
+            };
+
+            template<typename T>
+            struct inverse_trig_constants;
+
+            template<>
+            struct inverse_trig_constants<double> {
+                static constexpr double pio4_hi = 0x1.921fb54442d18p-1;
+                static constexpr double pio4_lo = 0x1.1a62633145c07p-55;
+                static constexpr double pio2_hi = 0x1.921fb54442d18p0;
+                static constexpr double pio2_lo = 0x1.1a62633145c07p-54;
+                static constexpr double pi_hi = 0x1.921fb54442d18p1;
+                static constexpr double pi_lo = 0x1.1a62633145c07p-53;
+                static constexpr double tan_pi_8 = 0x1.a827999fcef32p-2;
+            };
+
+            template<>
+            struct inverse_trig_constants<float> {
+                static constexpr float pio4_hi = 0x1.921fb6p-1f;
+                static constexpr float pio4_lo = -0x1.777a5cp-26f;
+                static constexpr float pio2_hi = 0x1.921fb6p0f;
+                static constexpr float pio2_lo = -0x1.777a5cp-25f;
+                static constexpr float pi_hi = 0x1.921fb6p1f;
+                static constexpr float pi_lo = -0x1.777a5cp-24f;
+                static constexpr float tan_pi_8 = 0x1.a8279ap-2f;
+            };
+
+            /// @brief sign bit of x, as a lane mask (true for -0)
+            template<typename T, typename Lane>
+            static INLINED auto sign_mask(const typename Lane::type x) {
+                using ibits = typename Lane::ibits;
+                const typename Lane::itype sign = Lane::ibroadcast(static_cast<ibits>(1) << (8 * sizeof(T) - 1));
+                return Lane::ieq(Lane::iand(Lane::as_bits(x), sign), sign);
+            }
+
+            /// @brief |r| with the sign of x, for r nonnegative
+            template<typename T, typename Lane>
+            static INLINED typename Lane::type copysign_lane(const typename Lane::type r, const typename Lane::type x) {
+                using ibits = typename Lane::ibits;
+                const typename Lane::itype sign = Lane::ibroadcast(static_cast<ibits>(1) << (8 * sizeof(T) - 1));
+                return Lane::from_bits(Lane::ixor(Lane::as_bits(r), Lane::iand(Lane::as_bits(x), sign)));
+            }
+
+            /// @brief angle of (x, y) in [0, pi] for nonnegative y and |x|, not both infinite
+            ///
+            /// y / |x| is reduced in [-tan(pi/8), tan(pi/8)] with a single division :
+            /// atan(u) = pi/2 - atan(1/u) and atan(u) = pi/4 + atan((u - 1) / (u + 1)).
+            /// The result is assembled once as A + sigma * (B + atan(t)), constants in two parts, so that
+            /// reflections for negative x do not accumulate roundings
+            template<typename T, typename Lane>
+            static INLINED typename Lane::type atan_core(
+                    const typename Lane::type y, const typename Lane::type ax, const typename Lane::mask x_neg) {
+                using C = inverse_trig_constants<T>;
+                using type = typename Lane::type;
+                const type zero = Lane::broadcast(static_cast<T>(0));
+                const type one = Lane::broadcast(static_cast<T>(1));
+                const auto swap = Lane::gt(y, ax);
+                const type n = Lane::select(swap, ax, y);
+                const type d = Lane::select(swap, y, ax);
+                const auto mid = Lane::gt(n, Lane::mul(d, Lane::broadcast(C::tan_pi_8)));
+                const type num = Lane::select(mid, Lane::sub(n, d), n);
+                const type den = Lane::select(mid, Lane::add(n, d), d);
+                // atan2(0, 0)
+                const type t = Lane::select(Lane::eq(den, zero), zero, Lane::div(num, den));
+                const type z = Lane::mul(t, t);
+                const type p = Lane::mul(Lane::mul(t, z),
+                    aerobus::internal::lane_horner<Lane, typename atan_poly<T>::type>::func(z));
+                // A = 0, pi/2 or pi ; B = 0 or pi/4 ; sigma = -1 when exactly one of swap and x_neg
+                const type a_hi = Lane::select(swap,
+                    Lane::broadcast(C::pio2_hi), Lane::select(x_neg, Lane::broadcast(C::pi_hi), zero));
+                const type a_lo = Lane::select(swap,
+                    Lane::broadcast(C::pio2_lo), Lane::select(x_neg, Lane::broadcast(C::pi_lo), zero));
+                const type b_hi = Lane::select(mid, Lane::broadcast(C::pio4_hi), zero);
+                const type b_lo = Lane::select(mid, Lane::broadcast(C::pio4_lo), zero);
+                type sigma = Lane::select(swap, Lane::sub(zero, one), one);
+                sigma = Lane::select(x_neg, Lane::sub(zero, sigma), sigma);
+                const type inner = Lane::add(t, Lane::add(p, b_lo));
+                return Lane::add(a_hi, Lane::fma(sigma, b_hi, Lane::fma(sigma, inner, a_lo)));
+            }
+
+            /// @brief branchless arctangent on a whole lane
+            /// @tparam T float or double
+            template<typename T>
+            struct atan_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    const typename Lane::type one = Lane::broadcast(static_cast<T>(1));
+                    // x_neg is always false here
+                    const typename Lane::type r = atan_core<T, Lane>(Lane::abs(x), one, Lane::lt(one, one));
+                    return Lane::select(Lane::eq(x, x), copysign_lane<T, Lane>(r, x), x);
+                }
+            };
+
+            /// @brief branchless atan2(y, x) on a whole lane -- follows C99 conventions for zeros and infinities
+            /// @tparam T float or double
+            template<typename T>
+            struct atan2_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type y, const typename Lane::type x) {
+                    using type = typename Lane::type;
+                    type ax = Lane::abs(x), ay = Lane::abs(y);
+                    // both infinite : same angle as (1, 1)
+                    const type max = Lane::broadcast(std::numeric_limits<T>::max());
+                    const type one = Lane::broadcast(static_cast<T>(1));
+                    const type ax_inf = Lane::select(Lane::gt(ay, max), one, ax);
+                    ay = Lane::select(Lane::gt(ax, max), Lane::select(Lane::gt(ay, max), one, ay), ay);
+                    ax = Lane::select(Lane::gt(ax, max), ax_inf, ax);
+                    type r = atan_core<T, Lane>(ay, ax, sign_mask<T, Lane>(x));
+                    r = copysign_lane<T, Lane>(r, y);
+                    r = Lane::select(Lane::eq(x, x), r, x);
+                    return Lane::select(Lane::eq(y, y), r, y);
+                }
             };
 
-            template<>
-            struct cos_poly<__half2> {
-                // approximates (cos(x) - 1)/x^2
-                // must be evaluated in x*x as we removed half the coefficients to have a dense polynomial
-                using type = typename aerobus::polynomial<aerobus::q16>::simplify_t<
-                    typename aerobus::polynomial<aerobus::q16>:: template val<
-                        aerobus::make_q16_t<-1, 1589>,
-                        aerobus::make_q16_t<1, 992>,
-                        aerobus::make_q16_t<-1, 1821>,
-                        aerobus::make_q16_t<-1, 795>,
-                        aerobus::make_q16_t<1, 24>,
-                        aerobus::make_q16_t<-1, 2>>>;
+            /// @brief asin(|x|) = p for |x| <= 1/2, pi/2 - 2p otherwise, with p = s + s^3 R(s^2)
+            /// and s = |x| or sqrt((1 - |x|) / 2) -- returns NaN in p for |x| > 1
+            template<typename T, typename Lane>
+            static INLINED typename Lane::type asin_core(const typename Lane::type a, typename Lane::mask *big) {
+                using type = typename Lane::type;
+                const type half = Lane::broadcast(static_cast<T>(0.5));
+                *big = Lane::gt(a, half);
+                const type z = Lane::select(*big, Lane::mul(Lane::sub(Lane::broadcast(static_cast<T>(1)), a), half),
+                    Lane::mul(a, a));
+                const type s = Lane::select(*big, Lane::sqrt(z), a);
+                // rounding error of sqrt, (z - s^2) / 2s, only matters when |x| > 1/2 and |x| != 1
+                const type zero = Lane::broadcast(static_cast<T>(0));
+                const type e = Lane::div(Lane::fnma(s, s, z), Lane::add(s, s));
+                const type q = Lane::mul(Lane::mul(s, z),
+                    aerobus::internal::lane_horner<Lane, typename asin_poly<T>::type>::func(z));
+                return Lane::add(s, Lane::add(q, Lane::select(*big, Lane::select(Lane::gt(s, zero), e, zero), zero)));
+            }
+
+            /// @brief branchless arcsine on a whole lane
+            /// @tparam T float or double
+            template<typename T>
+            struct asin_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using C = inverse_trig_constants<T>;
+                    using type = typename Lane::type;
+                    typename Lane::mask big;
+                    const type p = asin_core<T, Lane>(Lane::abs(x), &big);
+                    const type r = Lane::select(big,
+                        Lane::sub(Lane::broadcast(C::pio2_hi), Lane::sub(Lane::add(p, p), Lane::broadcast(C::pio2_lo))),
+                        p);
+                    return copysign_lane<T, Lane>(r, x);
+                }
             };
-            #endif
-        }  // namespace internal
 
-        // template<typename T>
-        // static T exp2(const T&x) {
-        //     using poly = internal::exp2_poly<T>::type;
-        //     if (x >= (aerobus::arithmetic_helpers<T>::zero) &&
-        //         x < (aerobus::arithmetic_helpers<T>::one)) {
-        //             return poly::eval(x);
-        //     } else {
-        //         // TODO(JeWaVe): handle denormals
-        //         auto i = static_cast<typename aerobus::arithmetic_helpers<T>::integers>(
-        //             aerobus::meta_libm<T>::floor(x));
-        //         T eps = x - i;
-        //         T mantissa = poly::eval(eps);
-        //         uint64_t* p = reinterpret_cast<uint64_t*>(&mantissa);
-        //         uint64_t exponent = (*p >> 52) & 0x7FF;
-        //         exponent += i;
-        //         *p &= ~(0x7FFULL << 52);
-        //         *p |= (exponent & 0x7FF) << 52;
-        //         return mantissa;
-        //     }
-        // }
+            /// @brief branchless arccosine on a whole lane
+            /// @tparam T float or double
+            template<typename T>
+            struct acos_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using C = inverse_trig_constants<T>;
+                    using type = typename Lane::type;
+                    typename Lane::mask big;
+                    const type p = asin_core<T, Lane>(Lane::abs(x), &big);
+                    // |x| <= 1/2 : pi/2 - asin(x)
+                    const type small = Lane::sub(Lane::broadcast(C::pio2_hi),
+                        Lane::sub(copysign_lane<T, Lane>(p, x), Lane::broadcast(C::pio2_lo)));
+                    // x > 1/2 : 2 asin(sqrt((1 - x) / 2)), x < -1/2 : pi - 2 asin(sqrt((1 + x) / 2))
+                    const type p2 = Lane::add(p, p);
+                    const type large = Lane::select(sign_mask<T, Lane>(x),
+                        Lane::sub(Lane::broadcast(C::pi_hi), Lane::sub(p2, Lane::broadcast(C::pi_lo))), p2);
+                    return Lane::select(big, large, small);
+                }
+            };
+        }  // namespace internal
 
-        template<typename T>
+        template<typename T, typename Accuracy = accuracy::ulp1>
         static DEVICE T cos(const T& x);
 
-        template<typename T>
+        template<typename T, typename Accuracy = accuracy::ulp1>
         static DEVICE T fast_cos(const T& x);
 
         // works only in [-pi/4, pi/4]
         // purpose is to allow vectorization
-        template<typename T>
+        template<typename T, typename Accuracy = accuracy::ulp1>
         static DEVICE INLINED T fast_sin(const T& x) {
             #if !defined(__CUDACC__) && !defined(__HIPCC__)
             // how to do that in CUDA/HIP??
             // auto rounding = std::fegetround();
             // std::fesetround(FE_TOWARDZERO);
             #endif
-            using poly = internal::sin_poly<T>::type;
-            auto result = x * poly::eval(x);
+            using poly = internal::sin_poly<T, Accuracy>::type;
+            auto result = x * poly::eval(x * x);
             #if !defined(__CUDACC__) && !defined(__HIPCC__)
             // std::fesetround(rounding);
             #endif
             return result;
         }
 
+        namespace internal {
+            /// @brief fixed point big number, little endian 32 bits limbs, last limb is the integer part
+            /// used only at compile time to generate bits of 2/pi
+            /// @tparam W number of limbs
+            template<size_t W>
+            struct big_fixed {
+                std::array<uint32_t, W> limbs {};
+
+                static constexpr big_fixed from_int(uint32_t x) {
+                    big_fixed result;
+                    result.limbs[W - 1] = x;
+                    return result;
+                }
+
+                constexpr bool is_zero() const {
+                    for (size_t i = 0; i < W; ++i) {
+                        if (limbs[i] != 0) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                constexpr big_fixed operator+(const big_fixed& o) const {
+                    big_fixed result;
+                    uint64_t carry = 0;
+                    for (size_t i = 0; i < W; ++i) {
+                        uint64_t s = static_cast<uint64_t>(limbs[i]) + o.limbs[i] + carry;
+                        result.limbs[i] = static_cast<uint32_t>(s);
+                        carry = s >> 32;
+                    }
+                    return result;
+                }
+
+                constexpr big_fixed operator-(const big_fixed& o) const {
+                    big_fixed result;
+                    int64_t borrow = 0;
+                    for (size_t i = 0; i < W; ++i) {
+                        int64_t d = static_cast<int64_t>(limbs[i]) - o.limbs[i] - borrow;
+                        borrow = d < 0 ? 1 : 0;
+                        result.limbs[i] = static_cast<uint32_t>(d + (borrow << 32));
+                    }
+                    return result;
+                }
+
+                constexpr bool operator>=(const big_fixed& o) const {
+                    for (size_t i = W; i-- > 0;) {
+                        if (limbs[i] != o.limbs[i]) {
+                            return limbs[i] > o.limbs[i];
+                        }
+                    }
+                    return true;
+                }
+
+                constexpr big_fixed mul_small(uint32_t m) const {
+                    big_fixed result;
+                    uint64_t carry = 0;
+                    for (size_t i = 0; i < W; ++i) {
+                        uint64_t p = static_cast<uint64_t>(limbs[i]) * m + carry;
+                        result.limbs[i] = static_cast<uint32_t>(p);
+                        carry = p >> 32;
+                    }
+                    return result;
+                }
+
+                constexpr big_fixed div_small(uint32_t d) const {
+                    big_fixed result;
+                    uint64_t rem = 0;
+                    for (size_t i = W; i-- > 0;) {
+                        uint64_t cur = (rem << 32) | limbs[i];
+                        result.limbs[i] = static_cast<uint32_t>(cur / d);
+                        rem = cur % d;
+                    }
+                    return result;
+                }
+
+                // arctan(1/n)
+                static constexpr big_fixed atan_inv(uint32_t n) {
+                    big_fixed power = from_int(1).div_small(n);
+                    big_fixed result = power;
+                    bool negative = true;
+                    for (uint32_t k = 3; !power.is_zero(); k += 2) {
+                        power = power.div_small(n * n);
+                        big_fixed term = power.div_small(k);
+                        result = negative ? result - term : result + term;
+                        negative = !negative;
+                    }
+                    return result;
+                }
+
+                // Machin formula
+                static constexpr big_fixed pi() {
+                    return atan_inv(5).mul_small(16) - atan_inv(239).mul_small(4);
+                }
+            };
+
+            /// @brief first N * 32 bits of the fractional part of 2/pi, most significant limb first
+            ///
+            /// computed at compile time : pi with Machin formula, then binary long division of 2 by pi
+            /// @tparam N number of limbs
+            template<size_t N>
+            static constexpr std::array<uint32_t, N> compute_two_over_pi() {
+                // 64 guard bits absorb truncation errors in the series
+                using fixed = big_fixed<N + 3>;
+                const fixed pi = fixed::pi();
+                fixed remainder = fixed::from_int(2);
+                std::array<uint32_t, N> result {};
+                for (size_t bit = 0; bit < 32 * N; ++bit) {
+                    remainder = remainder + remainder;
+                    uint32_t b = 0;
+                    if (remainder >= pi) {
+                        remainder = remainder - pi;
+                        b = 1;
+                    }
+                    result[bit / 32] |= b << (31 - (bit % 32));
+                }
+                return result;
+            }
+
+            // enough bits for the largest double exponent : (1023 - 52) / 32 + 7 limbs
+            static constexpr std::array<uint32_t, 40> two_over_pi_bits = compute_two_over_pi<40>();
+
+            /// @brief result of Payne-Hanek reduction : x = (quadrant + 4 * n) * pi/2 + r, with |r| <= pi/4
+            struct payne_hanek_result {
+                uint32_t quadrant;
+                aerobus::double_double r;
+            };
+
+            /// @brief Payne-Hanek reduction of a (large, finite, positive) double
+            ///
+            /// x = m * 2^e, with m integer on 53 bits : only the bits of 2/pi with weight
+            /// between 2^(1-e) and 2^(-e-190) or so contribute to x * 2/pi mod 4,
+            /// so we multiply m by a window of seven 32 bits limbs of two_over_pi_bits
+            /// @param x
+            static INLINED DEVICE payne_hanek_result payne_hanek(const double x) {
+                const uint64_t bits = std::bit_cast<uint64_t>(x);
+                const int32_t biased = static_cast<int32_t>((bits >> 52) & 0x7FF);
+                const uint64_t m = (bits & ((1ULL << 52) - 1)) | (biased != 0 ? (1ULL << 52) : 0);
+                const int32_t e = (biased != 0 ? biased : 1) - 1075;
+                // first limb holding bits of weight >= 2^(1-e) in 2/pi
+                const int32_t l0 = e >= 2 ? (e - 2) / 32 : 0;
+
+                // product m * window, little endian
+                uint32_t p[9] = {};
+                const uint32_t m_limbs[2] = { static_cast<uint32_t>(m), static_cast<uint32_t>(m >> 32) };
+                for (int32_t j = 0; j < 7; ++j) {
+                    const uint64_t w = two_over_pi_bits[l0 + 6 - j];
+                    uint64_t carry = 0;
+                    for (int32_t i = 0; i < 2; ++i) {
+                        uint64_t t = w * m_limbs[i] + p[i + j] + carry;
+                        p[i + j] = static_cast<uint32_t>(t);
+                        carry = t >> 32;
+                    }
+                    p[j + 2] = static_cast<uint32_t>(carry);
+                }
+
+                // p * 2^(-s) = x * 2/pi, mod 4 and truncated
+                const int32_t s = 32 * (l0 + 7) - e;
+                auto get32 = [&p](int32_t pos) -> uint32_t {
+                    const int32_t index = pos / 32;
+                    const int32_t shift = pos % 32;
+                    if (shift == 0) {
+                        return p[index];
+                    }
+                    const uint32_t high = index + 1 < 9 ? p[index + 1] : 0;
+                    return (p[index] >> shift) | (high << (32 - shift));
+                };
+                uint32_t quadrant = get32(s) & 3;
+                // fraction, on 128 bits, most significant first
+                uint32_t f[4] = { get32(s - 32), get32(s - 64), get32(s - 96), get32(s - 128) };
+                bool negate = false;
+                if ((f[0] >> 31) != 0) {
+                    // fraction >= 1/2 : round k up and take 1 - fraction
+                    quadrant += 1;
+                    negate = true;
+                    uint64_t borrow = 0;
+                    for (int32_t i = 3; i >= 0; --i) {
+                        uint64_t d = 0 - static_cast<uint64_t>(f[i]) - borrow;
+                        f[i] = static_cast<uint32_t>(d);
+                        borrow = (f[i] != 0 || borrow != 0) ? 1 : 0;
+                    }
+                }
+
+                // normalize fraction and split it into two 53 bits parts : fraction = a + b exactly, |b| < ulp(a)
+                uint64_t n_hi = (static_cast<uint64_t>(f[0]) << 32) | f[1];
+                uint64_t n_lo = (static_cast<uint64_t>(f[2]) << 32) | f[3];
+                int32_t lz = 0;
+                if (n_hi == 0) {
+                    n_hi = n_lo;
+                    n_lo = 0;
+                    lz = 64;
+                }
+                if (n_hi == 0) {
+                    return { quadrant & 3, aerobus::double_double(0.0) };
+                }
+                const int32_t shift = std::countl_zero(n_hi);
+                if (shift != 0) {
+                    n_hi = (n_hi << shift) | (n_lo >> (64 - shift));
+                    n_lo <<= shift;
+                }
+                lz += shift;
+                // 2^k for k >= -1022
+                auto pow2 = [](int32_t k) -> double {
+                    return std::bit_cast<double>(static_cast<uint64_t>(1023 + k) << 52);
+                };
+                const double a = static_cast<double>(n_hi >> 11) * pow2(-53 - lz);
+                const double b = static_cast<double>(((n_hi & 0x7FF) << 42) | (n_lo >> 22)) * pow2(-106 - lz);
+                const aerobus::double_double fraction(a, b);
+                aerobus::double_double r = fraction * aerobus::arithmetic_helpers<aerobus::double_double>::pi_2();
+                return { quadrant & 3, negate ? -r : r };
+            }
+
+            template<typename T, typename Lane, typename Accuracy>
+            static INLINED void sincos_lane_compensated(typename Lane::type hi, typename Lane::type lo,
+                                                        typename Lane::type *s, typename Lane::type *c);
+
+            /// @brief sin(r) and cos(r) of a Payne-Hanek remainder, with its trailing part when Accuracy asks for it
+            template<typename T, typename Accuracy>
+            static INLINED void sincos_remainder(const aerobus::double_double& r, T* fs, T* fc) {
+                if constexpr (Accuracy::compensated_reduction) {
+                    const T hi = static_cast<T>(r.hi);
+                    const T lo = static_cast<T>((r.hi - static_cast<double>(hi)) + r.lo);
+                    sincos_lane_compensated<T, aerobus::internal::scalar_lane<T>, Accuracy>(hi, lo, fs, fc);
+                } else {
+                    const T t = static_cast<T>(static_cast<double>(r));
+                    *fs = aerobus::libm::fast_sin(t);
+                    *fc = aerobus::libm::fast_cos(t);
+                }
+            }
+
+            /// @brief sin (or cos) of arguments too large for Cody-Waite, through Payne-Hanek reduction
+            /// @tparam T float or double
+            /// @tparam cosine true for cos, false for sin
+            /// @tparam Accuracy accuracy tier
+            /// @param x finite value
+            template<typename T, bool cosine, typename Accuracy>
+            static INLINED T sin_cos_huge(const T& x) {
+                const double ax = std::fabs(static_cast<double>(x));
+                payne_hanek_result reduced = payne_hanek(ax);
+                uint32_t quadrant = reduced.quadrant;
+                if constexpr (cosine) {
+                    quadrant += 1;
+                } else if (x < 0) {
+                    quadrant += 2;
+                }
+                T fs, fc;
+                sincos_remainder<T, Accuracy>(reduced.r, &fs, &fc);
+                const T result = (quadrant & 1) != 0 ? fc : fs;
+                return (quadrant & 2) != 0 ? -result : result;
+            }
+
+            /// @brief sin and cos of arguments too large for Cody-Waite, sharing one Payne-Hanek reduction
+            /// @tparam T float or double
+            /// @tparam Accuracy accuracy tier
+            /// @param x finite value
+            /// @param s sin(x)
+            /// @param c cos(x)
+            template<typename T, typename Accuracy>
+            static INLINED void sincos_huge(const T& x, T* s, T* c) {
+                const double ax = std::fabs(static_cast<double>(x));
+                payne_hanek_result reduced = payne_hanek(ax);
+                const uint32_t qs = reduced.quadrant + (x < 0 ? 2 : 0);
+                const uint32_t qc = reduced.quadrant + 1;
+                T fs, fc;
+                sincos_remainder<T, Accuracy>(reduced.r, &fs, &fc);
+                const T rs = (qs & 1) != 0 ? fc : fs;
+                const T rc = (qc & 1) != 0 ? fc : fs;
+                *s = (qs & 2) != 0 ? -rs : rs;
+                *c = (qc & 2) != 0 ? -rc : rc;
+            }
+
+            // SIMD kernels, defined below, also serve scalar functions for float and double
+            template<typename T, bool cosine, typename Accuracy = accuracy::ulp1>
+            struct sin_cos_kernel;
+
+            // scalar sin and cos go through the (scalar lane of) SIMD kernels, unless T has none and Accuracy
+            // asks for a reduction in upper_type
+            template<typename T, typename Accuracy>
+            static constexpr bool scalar_kernel =
+                !Accuracy::upper_reduction || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+            template<typename T, typename Accuracy = accuracy::ulp1>
+            struct sincos_kernel;
+        }  // namespace internal
+
         template<typename T>
         struct sin_reduction {
             using upper_type = aerobus::arithmetic_helpers<T>::upper_type;
@@ -4594,6 +8269,8 @@ namespace aerobus {
 
             struct behavior {
                 bool negate = false;
+                // sign of cos, tracked along reflections so that one reduction serves sincos
+                bool negate_cos = false;
                 bool return_x = false;
                 bool return_fast_sin = false;
                 bool return_fast_cos = false;
@@ -4607,6 +8284,9 @@ namespace aerobus {
 
             static DEVICE behavior eval(upper_type u_x, T x) {
                 const T eps = std::numeric_limits<T>::epsilon();
+                // compared in upper_type : in T, pi +/- eps may round back to pi and reflections would cycle
+                const upper_type pi_m_eps = pi - upper_type(eps);
+                const upper_type pi_p_eps = pi + upper_type(eps);
                 behavior result {};
                 while (true) {
                     // std::cout << std::hexfloat << "entering reduction with " << u_x << " - " << x << std::endl;
@@ -4629,12 +8309,14 @@ namespace aerobus {
                         result.transform = pi_2 - u_x;
                         // std::cout << "returning from reduction with " << u_x << " and return_fast_cos" << std::endl;
                         return result;
-                    } else if (x < constants::pi() - eps) {
+                    } else if (u_x < pi_m_eps) {
                         u_x = pi - u_x;
                         x = static_cast<T>(u_x);
+                        result.negate_cos = !result.negate_cos;
                         continue;
-                    } else if (x < constants::pi() + eps) {
-                        result.negate = true;
+                    } else if (u_x < pi_p_eps) {
+                        result.negate = !result.negate;
+                        result.negate_cos = !result.negate_cos;
                         result.return_x = true;
                         result.transform = u_x - pi;
                         return result;
@@ -4643,6 +8325,10 @@ namespace aerobus {
                         x = static_cast<T>(u_x);
                         result.negate = !result.negate;
                         continue;
+                    } else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+                        // x is positive and exact here : fmod with a double_double 2 pi would lose about
+                        // 2^-106 * x near multiples of pi, Payne-Hanek does not
+                        return from_quadrant(internal::payne_hanek(static_cast<double>(x)), result);
                     } else {
                         u_x = aerobus::meta_libm<upper_type>::fmod(u_x, u_constants::two_pi());
                         x = static_cast<T>(u_x);
@@ -4650,10 +8336,85 @@ namespace aerobus {
                     }
                 }
             }
+
+         private:
+            // x = quadrant * pi/2 + r : sin(x) = sin(r), cos(r), -sin(r), -cos(r) and cos(x) follows one step later
+            static DEVICE behavior from_quadrant(const internal::payne_hanek_result& reduced, behavior result) {
+                const upper_type r = static_cast<upper_type>(reduced.r);
+                if ((reduced.quadrant & 1) != 0) {
+                    // sin(pi/2 + r) = cos(-r) and cos(pi/2 + r) = sin(-r)
+                    result.return_fast_cos = true;
+                    result.transform = -r;
+                } else {
+                    result.return_fast_sin = true;
+                    result.transform = r;
+                }
+                if ((reduced.quadrant & 2) != 0) {
+                    result.negate = !result.negate;
+                    result.negate_cos = !result.negate_cos;
+                }
+                return result;
+            }
+
+         public:
+
+            // evaluates sin from the result of eval
+            static DEVICE T apply(const behavior& behavior) {
+                if (behavior.return_x) {
+                    T result = static_cast<T>(behavior.transform);
+                    return behavior.negate ? -result : result;
+                } else if (behavior.return_fast_cos) {
+                    T result = aerobus::libm::fast_cos(static_cast<T>(behavior.transform));
+                    return behavior.negate ? -result : result;
+                } else if (behavior.return_fast_sin) {
+                    T result = aerobus::libm::fast_sin(static_cast<T>(behavior.transform));
+                    return behavior.negate ? -result : result;
+                } else {
+                    return NAN;
+                }
+            }
+
+            // evaluates cos from the result of eval
+            static DEVICE T apply_cos(const behavior& behavior) {
+                T result;
+                if (behavior.return_x) {
+                    result = constants::one();
+                } else if (behavior.return_fast_cos) {
+                    result = aerobus::libm::fast_sin(static_cast<T>(behavior.transform));
+                } else {
+                    result = aerobus::libm::fast_cos(static_cast<T>(behavior.transform));
+                }
+                return behavior.negate_cos ? -result : result;
+            }
+
+            // evaluates both sin and cos from the result of eval
+            static DEVICE void apply_sincos(const behavior& behavior, T* s, T* c) {
+                const T t = static_cast<T>(behavior.transform);
+                if (behavior.return_x) {
+                    *s = behavior.negate ? -t : t;
+                    *c = behavior.negate_cos ? -constants::one() : constants::one();
+                    return;
+                }
+                // independent dependency chains : interleaved once inlined
+                const T fs = aerobus::libm::fast_sin(t);
+                const T fc = aerobus::libm::fast_cos(t);
+                const T rs = behavior.return_fast_cos ? fc : fs;
+                const T rc = behavior.return_fast_cos ? fs : fc;
+                *s = behavior.negate ? -rs : rs;
+                *c = behavior.negate_cos ? -rc : rc;
+            }
         };
 
-        template<typename T>
+        /// @brief sin(x)
+        /// @tparam T arithmetic type
+        /// @tparam Accuracy accuracy tier -- float and double use the branchless SIMD kernel of sin_n
+        /// @param x argument
+        template<typename T, typename Accuracy = accuracy::ulp1>
         static DEVICE T sin(const T& x) {
+            if constexpr (internal::scalar_kernel<T, Accuracy>) {
+                using kernel = internal::sin_cos_kernel<T, false, Accuracy>;
+                return kernel::template func<aerobus::internal::scalar_lane<T>>(x);
+            }
             if (x != x) {  // NaN
                 return x;
             } else if (aerobus::arithmetic_helpers<T>::is_inf(x)) {
@@ -4662,61 +8423,517 @@ namespace aerobus {
             // TODO(JeWaVe) : final rounding -- see https://k0d.cc/storage/books/Algorithms/Elementary%20Functions.pdf
             using upper_type = aerobus::arithmetic_helpers<T>::upper_type;
             upper_type X = aerobus::internal::staticcast<upper_type, T>::eval(x);
-            auto behavior = sin_reduction<T>::eval(X, x);
-            if (behavior.return_x) {
-                T result = static_cast<T>(behavior.transform);
-                return behavior.negate ? -result : result;
-            } else if (behavior.return_fast_cos) {
-                T result = aerobus::libm::fast_cos(static_cast<T>(behavior.transform));
-                return behavior.negate ? -result : result;
-            } else if (behavior.return_fast_sin) {
-                T result = aerobus::libm::fast_sin(static_cast<T>(behavior.transform));
-                return behavior.negate ? -result : result;
-            } else {
-                return NAN;
-            }
+            return sin_reduction<T>::apply(sin_reduction<T>::eval(X, x));
         }  // NOLINT
 
-        template<typename T>
+        template<typename T, typename Accuracy>
         static DEVICE T fast_cos(const T& x) {
-            using poly = internal::cos_poly<T>::type;
+            using poly = internal::cos_poly<T, Accuracy>::type;
             using constants = aerobus::arithmetic_helpers<T>;
             T one = constants::one();
             T x2 = x*x;
             return aerobus::internal::fma_helper<T>::eval(x2, poly::eval(x2), one);
         }
 
-        // TODO(JeWaVe) : range reduction in upper_type
-        template<typename T>
+        template<typename T, typename Accuracy>
         static DEVICE T cos(const T& x) {
+            if constexpr (internal::scalar_kernel<T, Accuracy>) {
+                using kernel = internal::sin_cos_kernel<T, true, Accuracy>;
+                return kernel::template func<aerobus::internal::scalar_lane<T>>(x);
+            }
             using upper_type = aerobus::arithmetic_helpers<T>::upper_type;
             using u_constants = aerobus::arithmetic_helpers<upper_type>;
             upper_type pi_4 = u_constants::pi_4();
-            upper_type pi = u_constants::pi();
-            upper_type two_pi = u_constants::two_pi();
-            upper_type pi_2 = u_constants::pi_2();
             upper_type X = aerobus::internal::staticcast<upper_type, T>::eval(x);
-            // domain reduction
             if (x != x) {  // NaN
                 return x;
             } else if (aerobus::arithmetic_helpers<T>::is_inf(x)) {
                 return NAN;
             } else if (x <= std::numeric_limits<T>::epsilon() && x >= -std::numeric_limits<T>::epsilon()) {
                 return aerobus::arithmetic_helpers<T>::one();
-            } else if (x < -std::numeric_limits<T>::epsilon()) {
-                return aerobus::libm::cos(static_cast<T>(-X));
-            } else if (X <= pi_4) {
+            } else if (X <= pi_4 && X >= -pi_4) {
                 return aerobus::libm::fast_cos(x);
-            } else if (X <= pi_2) {
-                return aerobus::libm::sin(static_cast<T>(pi_2 - X));
-            } else if (X <= pi) {
-                return -aerobus::libm::cos(static_cast<T>(X - pi));
-            } else if (X <= two_pi) {
-                return -aerobus::libm::cos(static_cast<T>(pi - X));
-            } else {
-                T i = static_cast<T>(aerobus::meta_libm<upper_type>::fmod(X, two_pi));
-                return aerobus::libm::cos(i);
             }
+            // the reduction of sin tracks the sign of cos : no shift by pi/2, which would round x before reduction
+            return sin_reduction<T>::apply_cos(sin_reduction<T>::eval(X, x));
+        }
+
+        /// @brief sin and cos of the same argument, with a single range reduction
+        /// @tparam T arithmetic type
+        /// @tparam Accuracy accuracy tier
+        /// @param x argument
+        /// @param s sin(x)
+        /// @param c cos(x)
+        template<typename T, typename Accuracy = accuracy::ulp1>
+        static DEVICE void sincos(const T& x, T* s, T* c) {
+            if constexpr (internal::scalar_kernel<T, Accuracy>) {
+                internal::sincos_kernel<T, Accuracy>::template func<aerobus::internal::scalar_lane<T>>(x, s, c);
+                return;
+            }
+            if (x != x) {  // NaN
+                *s = x;
+                *c = x;
+                return;
+            } else if (aerobus::arithmetic_helpers<T>::is_inf(x)) {
+                *s = NAN;
+                *c = NAN;
+                return;
+            }
+            using upper_type = aerobus::arithmetic_helpers<T>::upper_type;
+            upper_type X = aerobus::internal::staticcast<upper_type, T>::eval(x);
+            sin_reduction<T>::apply_sincos(sin_reduction<T>::eval(X, x), s, c);
+        }
+
+        namespace internal {
+            /// @brief Cody-Waite reduction on a whole lane : r = x - k * pi/2, with pi/2 in four parts
+            ///
+            /// returns k in the low bits of q (magic number trick), so that k mod 4 is read with integer masks
+            /// @tparam parts number of parts of pi/2 : 4, or 2 with the second carrying the rounded tail
+            template<typename T, typename Lane, size_t parts = 4>
+            static INLINED typename Lane::itype cody_waite_reduce(const typename Lane::type x, typename Lane::type *r) {
+                static_assert(parts == 2 || parts == 4, "Cody-Waite reduction uses 2 or 4 parts of pi/2");
+                using C = cody_waite<T>;
+                using type = typename Lane::type;
+                constexpr T round_magic = static_cast<T>(3) *
+                    static_cast<T>(1ULL << (aerobus::internal::FloatLayout<T>::mantissa - 1));
+                const type k = Lane::round(Lane::mul(x, Lane::broadcast(C::two_over_pi)));
+                *r = Lane::fnma(k, Lane::broadcast(C::pio2_1), x);
+                if constexpr (parts == 2) {
+                    *r = Lane::fnma(k, Lane::broadcast(C::pio2_2_tail), *r);
+                } else {
+                    *r = Lane::fnma(k, Lane::broadcast(C::pio2_2), *r);
+                    *r = Lane::fnma(k, Lane::broadcast(C::pio2_3), *r);
+                    *r = Lane::fnma(k, Lane::broadcast(C::pio2_4), *r);
+                }
+                // k mod 4 lives in the lowest bits of mantissa once 1.5 * 2^mantissa is added
+                return Lane::as_bits(Lane::add(k, Lane::broadcast(round_magic)));
+            }
+
+            /// @brief Cody-Waite reduction keeping its rounding error : x - k * pi/2 = *hi + *lo
+            ///
+            /// k * pio2_2 and k * pio2_3 are exact (k has at most 20 bits for double, 12 for float) :
+            /// the rounding error of each subtraction is recovered with one fma,
+            /// and only the tiny k * pio2_4 is rounded.
+            /// Without lo, r loses up to half an ulp before the polynomial, which is half an ulp of sin(r)
+            template<typename T, typename Lane>
+            static INLINED typename Lane::itype cody_waite_reduce_compensated(
+                    const typename Lane::type x, typename Lane::type *hi, typename Lane::type *lo) {
+                using C = cody_waite<T>;
+                using type = typename Lane::type;
+                constexpr T round_magic = static_cast<T>(3) *
+                    static_cast<T>(1ULL << (aerobus::internal::FloatLayout<T>::mantissa - 1));
+                const type k = Lane::round(Lane::mul(x, Lane::broadcast(C::two_over_pi)));
+                // exact : k * pio2_1 fits in the mantissa, and x is close to it
+                const type r = Lane::fnma(k, Lane::broadcast(C::pio2_1), x);
+                // r - h is exact, either by Sterbenz lemma or because h itself is exact
+                const type h1 = Lane::fnma(k, Lane::broadcast(C::pio2_2), r);
+                const type e1 = Lane::fnma(k, Lane::broadcast(C::pio2_2), Lane::barrier(Lane::sub(r, h1)));
+                const type h2 = Lane::fnma(k, Lane::broadcast(C::pio2_3), h1);
+                const type e2 = Lane::fnma(k, Lane::broadcast(C::pio2_3), Lane::barrier(Lane::sub(h1, h2)));
+                const type t = Lane::fnma(k, Lane::broadcast(C::pio2_4), Lane::add(e1, e2));
+                // |t| is far below |h2|
+                *hi = Lane::add(h2, t);
+                *lo = Lane::sub(t, Lane::barrier(Lane::sub(*hi, h2)));
+                return Lane::as_bits(Lane::add(k, Lane::broadcast(round_magic)));
+            }
+
+            /// @brief sin(hi + lo) and cos(hi + lo) for hi in [-pi/4, pi/4] and |lo| <= ulp(hi) / 2
+            ///
+            /// the leading terms, hi and 1 - hi^2 / 2, are added last to the polynomial tails and to the first order
+            /// terms in lo : the result is rounded about once (fdlibm __kernel_sin and __kernel_cos)
+            template<typename T, typename Lane, typename Accuracy>
+            static INLINED void sincos_lane_compensated(const typename Lane::type hi, const typename Lane::type lo,
+                                                        typename Lane::type *s, typename Lane::type *c) {
+                using type = typename Lane::type;
+                // sin(x) = x + x^3 qs(x^2), cos(x) = 1 - x^2 / 2 + x^4 qc(x^2)
+                using qs_t = typename drop_constant<typename sin_poly<T, Accuracy>::type>::type;
+                using qc_t = typename drop_constant<typename cos_poly<T, Accuracy>::type>::type;
+                const type one = Lane::broadcast(static_cast<T>(1));
+                const type half = Lane::broadcast(static_cast<T>(0.5));
+                type z, z_lo, qs, qc;
+                Lane::two_prod(hi, hi, &z, &z_lo);
+                aerobus::internal::lane_horner_pair<Lane, qs_t, qc_t>::func(z, &qs, &qc);
+                const type half_z = Lane::mul(half, z);
+                // hi^3 qs + lo (1 - hi^2 / 2)
+                const type ts = Lane::fma(Lane::mul(hi, z), qs, Lane::fnma(half_z, lo, lo));
+                // keeps the sign of zero
+                *s = Lane::select(Lane::eq(hi, Lane::broadcast(static_cast<T>(0))), hi, Lane::add(hi, ts));
+                // w = 1 - z / 2 rounded, its rounding error, then z^2 qc - z_lo / 2 - hi * lo
+                const type w = Lane::sub(one, half_z);
+                const type w_err = Lane::barrier(Lane::sub(Lane::barrier(Lane::sub(one, w)), half_z));
+                const type tc = Lane::fma(Lane::mul(z, z), qc, Lane::fnma(hi, lo, Lane::fnma(half, z_lo, w_err)));
+                *c = Lane::add(w, tc);
+            }
+
+            /// @brief fast_sin and fast_cos of r in [-pi/4, pi/4], with the two horner chains interleaved
+            template<typename T, typename Lane, typename Accuracy = accuracy::ulp1>
+            static INLINED void fast_sincos_lane(
+                    const typename Lane::type r, typename Lane::type *s, typename Lane::type *c) {
+                using type = typename Lane::type;
+                const type r2 = Lane::mul(r, r);
+                type ps, pc;
+                aerobus::internal::lane_horner_pair<Lane,
+                    typename sin_poly<T, Accuracy>::type, typename cos_poly<T, Accuracy>::type>::func(
+                    r2, &ps, &pc);
+                *s = Lane::mul(r, ps);
+                *c = Lane::fma(r2, pc, Lane::broadcast(aerobus::arithmetic_helpers<T>::one()));
+            }
+
+            /// @brief Cody-Waite reduction of x to k * pi/2 + r, then sin(r) and cos(r)
+            /// @return q, see quadrant_select
+            template<typename T, typename Lane, typename Accuracy>
+            static INLINED typename Lane::itype reduce_and_eval(
+                    const typename Lane::type x, typename Lane::type *s, typename Lane::type *c) {
+                if constexpr (Accuracy::compensated_reduction) {
+                    typename Lane::type hi, lo;
+                    const typename Lane::itype q = cody_waite_reduce_compensated<T, Lane>(x, &hi, &lo);
+                    sincos_lane_compensated<T, Lane, Accuracy>(hi, lo, s, c);
+                    return q;
+                } else {
+                    typename Lane::type r;
+                    const typename Lane::itype q = cody_waite_reduce<T, Lane, Accuracy::cody_waite_parts>(x, &r);
+                    fast_sincos_lane<T, Lane, Accuracy>(r, s, c);
+                    return q;
+                }
+            }
+
+            /// @brief sin(k * pi/2 + r) from fast_sin(r) and fast_cos(r), given k mod 4 in the low bits of q
+            template<typename T, typename Lane>
+            static INLINED typename Lane::type quadrant_select(
+                    const typename Lane::itype q, const typename Lane::type s, const typename Lane::type c) {
+                using itype = typename Lane::itype;
+                const itype one = Lane::ibroadcast(1);
+                const typename Lane::type result = Lane::select(Lane::ieq(Lane::iand(q, one), one), c, s);
+                const itype sign = Lane::template shl<cody_waite<T>::sign_bit - 1>(Lane::iand(q, Lane::ibroadcast(2)));
+                return Lane::from_bits(Lane::ixor(Lane::as_bits(result), sign));
+            }
+
+            /// @brief true if any value of the lane needs the scalar Payne-Hanek fallback (or is infinite)
+            template<typename T, typename Lane>
+            static INLINED bool any_huge(const typename Lane::type x) {
+                return Lane::any(Lane::gt(Lane::abs(x), Lane::broadcast(cody_waite<T>::threshold)));
+            }
+
+            /// @brief branchless sin (or cos) on a whole lane
+            ///
+            /// Cody-Waite reduction : k = round(x * 2/pi), r = x - k * pi/2 with pi/2 in four parts,
+            /// then fast_sin(r) or fast_cos(r) selected, and sign flipped, depending on quadrant k mod 4.
+            /// Lanes where |x| exceeds cody_waite<T>::threshold are recomputed one by one with Payne-Hanek reduction,
+            /// unless Accuracy opts out of special cases
+            /// @tparam T float or double
+            /// @tparam cosine true for cos, false for sin
+            /// @tparam Accuracy accuracy tier (accuracy::ulp1, ulp4 or approx_1e4)
+            template<typename T, bool cosine, typename Accuracy>
+            struct sin_cos_kernel {
+                template<typename Lane>
+                static INLINED typename Lane::type func(const typename Lane::type x) {
+                    using type = typename Lane::type;
+                    type s, c;
+                    typename Lane::itype q = reduce_and_eval<T, Lane, Accuracy>(x, &s, &c);
+                    if constexpr (cosine) {
+                        q = Lane::iadd(q, Lane::ibroadcast(1));
+                    }
+                    type result = quadrant_select<T, Lane>(q, s, c);
+
+                    if (Accuracy::special_cases && any_huge<T, Lane>(x)) [[unlikely]] {
+                        T xs[Lane::width], rs[Lane::width];
+                        Lane::storeu(xs, x);
+                        Lane::storeu(rs, result);
+                        for (size_t i = 0; i < Lane::width; ++i) {
+                            if (std::isinf(xs[i])) {
+                                rs[i] = std::numeric_limits<T>::quiet_NaN();
+                            } else if (std::fabs(xs[i]) > cody_waite<T>::threshold) {
+                                rs[i] = sin_cos_huge<T, cosine, Accuracy>(xs[i]);
+                            }
+                        }
+                        result = Lane::loadu(rs);
+                    }
+                    return result;
+                }
+            };
+
+            /// @brief branchless sin and cos on a whole lane, sharing reduction and polynomial evaluation
+            /// @tparam T float or double
+            /// @tparam Accuracy accuracy tier (accuracy::ulp1, ulp4 or approx_1e4)
+            template<typename T, typename Accuracy>
+            struct sincos_kernel {
+                template<typename Lane>
+                static INLINED void func(const typename Lane::type x, typename Lane::type *s, typename Lane::type *c) {
+                    using type = typename Lane::type;
+                    type fs, fc;
+                    const typename Lane::itype q = reduce_and_eval<T, Lane, Accuracy>(x, &fs, &fc);
+                    *s = quadrant_select<T, Lane>(q, fs, fc);
+                    *c = quadrant_select<T, Lane>(Lane::iadd(q, Lane::ibroadcast(1)), fs, fc);
+
+                    if (Accuracy::special_cases && any_huge<T, Lane>(x)) [[unlikely]] {
+                        T xs[Lane::width], ss[Lane::width], cs[Lane::width];
+                        Lane::storeu(xs, x);
+                        Lane::storeu(ss, *s);
+                        Lane::storeu(cs, *c);
+                        for (size_t i = 0; i < Lane::width; ++i) {
+                            if (std::isinf(xs[i])) {
+                                ss[i] = std::numeric_limits<T>::quiet_NaN();
+                                cs[i] = std::numeric_limits<T>::quiet_NaN();
+                            } else if (std::fabs(xs[i]) > cody_waite<T>::threshold) {
+                                sincos_huge<T, Accuracy>(xs[i], ss + i, cs + i);
+                            }
+                        }
+                        *s = Lane::loadu(ss);
+                        *c = Lane::loadu(cs);
+                    }
+                }
+            };
+        }  // namespace internal
+
+        /// @brief batched fast_sin (works only in [-pi/4, pi/4]) -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @tparam Accuracy accuracy tier
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T, typename Accuracy = accuracy::ulp1>
+        static INLINED void fast_sin_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::fast_sin_kernel<T, Accuracy>>::run(in, out, n);
+        }
+
+        /// @brief batched fast_cos (works only in [-pi/4, pi/4]) -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @tparam Accuracy accuracy tier
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T, typename Accuracy = accuracy::ulp1>
+        static INLINED void fast_cos_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::fast_cos_kernel<T, Accuracy>>::run(in, out, n);
+        }
+
+        /// @brief batched sin, full range
+        ///
+        /// uses a branchless Cody-Waite reduction and SIMD kernels when available
+        /// @tparam T float or double
+        /// @tparam Accuracy accuracy tier
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T, typename Accuracy = accuracy::ulp1>
+        static INLINED void sin_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::sin_cos_kernel<T, false, Accuracy>>::run(in, out, n);
+        }
+
+        /// @brief batched cos, full range
+        ///
+        /// uses a branchless Cody-Waite reduction and SIMD kernels when available
+        /// @tparam T float or double
+        /// @tparam Accuracy accuracy tier
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T, typename Accuracy = accuracy::ulp1>
+        static INLINED void cos_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::sin_cos_kernel<T, true, Accuracy>>::run(in, out, n);
+        }
+
+        /// @brief batched sincos, full range : one reduction and interleaved polynomials for both outputs
+        /// @tparam T float or double
+        /// @tparam Accuracy accuracy tier
+        /// @param in input values
+        /// @param out_sin sin of input values
+        /// @param out_cos cos of input values
+        /// @param n number of values
+        template<typename T, typename Accuracy = accuracy::ulp1>
+        static INLINED void sincos_n(const T* in, T* out_sin, T* out_cos, size_t n) {
+            aerobus::internal::batch_driver_pair<T, internal::sincos_kernel<T, Accuracy>>::run(in, out_sin, out_cos, n);
+        }
+
+        /// @brief 2^x
+        ///
+        /// branchless : clamped argument, exponent from bits and polynomial on the fractional part
+        /// @tparam T float or double
+        /// @param x argument
+        template<typename T>
+        static INLINED T exp2(const T& x) {
+            return internal::exp2_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(x);
+        }
+
+        /// @brief e^x
+        /// @tparam T float or double
+        /// @param x argument
+        template<typename T>
+        static INLINED T exp(const T& x) {
+            return internal::exp_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(x);
+        }
+
+        /// @brief e^x - 1, accurate for small x
+        /// @tparam T float or double
+        /// @param x argument
+        template<typename T>
+        static INLINED T expm1(const T& x) {
+            return internal::expm1_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(x);
+        }
+
+        /// @brief batched exp2 -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void exp2_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::exp2_kernel<T>>::run(in, out, n);
+        }
+
+        /// @brief batched exp -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void exp_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::exp_kernel<T>>::run(in, out, n);
+        }
+
+        /// @brief batched expm1 -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void expm1_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::expm1_kernel<T>>::run(in, out, n);
+        }
+
+        /// @brief natural logarithm
+        ///
+        /// branchless : exponent and mantissa from bits,
+        /// mantissa reduced in [sqrt(2)/2, sqrt(2)) and minimax polynomial
+        /// @tparam T float or double
+        /// @param x argument
+        template<typename T>
+        static INLINED T log(const T& x) {
+            return internal::log_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(x);
+        }
+
+        /// @brief base 2 logarithm
+        /// @tparam T float or double
+        /// @param x argument
+        template<typename T>
+        static INLINED T log2(const T& x) {
+            return internal::log2_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(x);
+        }
+
+        /// @brief log(1 + x), accurate for small x
+        /// @tparam T float or double
+        /// @param x argument
+        template<typename T>
+        static INLINED T log1p(const T& x) {
+            return internal::log1p_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(x);
+        }
+
+        /// @brief batched log -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void log_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::log_kernel<T>>::run(in, out, n);
+        }
+
+        /// @brief batched log2 -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void log2_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::log2_kernel<T>>::run(in, out, n);
+        }
+
+        /// @brief batched log1p -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void log1p_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::log1p_kernel<T>>::run(in, out, n);
+        }
+
+        /// @brief arctangent
+        ///
+        /// branchless : argument reduced in [-tan(pi/8), tan(pi/8)] with a single division, then minimax polynomial
+        /// @tparam T float or double
+        /// @param x argument
+        template<typename T>
+        static INLINED T atan(const T& x) {
+            return internal::atan_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(x);
+        }
+
+        /// @brief angle of (x, y) in [-pi, pi]
+        /// @tparam T float or double
+        /// @param y ordinate
+        /// @param x abscissa
+        template<typename T>
+        static INLINED T atan2(const T& y, const T& x) {
+            return internal::atan2_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(y, x);
+        }
+
+        /// @brief arcsine
+        ///
+        /// branchless : |x| > 1/2 is reduced with asin(x) = pi/2 - 2 asin(sqrt((1 - x) / 2))
+        /// @tparam T float or double
+        /// @param x argument
+        template<typename T>
+        static INLINED T asin(const T& x) {
+            return internal::asin_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(x);
+        }
+
+        /// @brief arccosine
+        /// @tparam T float or double
+        /// @param x argument
+        template<typename T>
+        static INLINED T acos(const T& x) {
+            return internal::acos_kernel<T>::template func<aerobus::internal::scalar_lane<T>>(x);
+        }
+
+        /// @brief batched atan -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void atan_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::atan_kernel<T>>::run(in, out, n);
+        }
+
+        /// @brief batched atan2 -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param y ordinates
+        /// @param x abscissas
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void atan2_n(const T* y, const T* x, T* out, size_t n) {
+            aerobus::internal::batch_driver_binary<T, internal::atan2_kernel<T>>::run(y, x, out, n);
+        }
+
+        /// @brief batched asin -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void asin_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::asin_kernel<T>>::run(in, out, n);
+        }
+
+        /// @brief batched acos -- uses SIMD kernels when available
+        /// @tparam T float or double
+        /// @param in input values
+        /// @param out output values
+        /// @param n number of values
+        template<typename T>
+        static INLINED void acos_n(const T* in, T* out, size_t n) {
+            aerobus::internal::batch_driver<T, internal::acos_kernel<T>>::run(in, out, n);
         }
     }  // namespace libm
 }  // namespace aerobus
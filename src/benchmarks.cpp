@@ -9,7 +9,10 @@ double rand(double min, double max) {
 }
 
 INLINED double aero_expm1_12(const double x) {
-    using EXPM1 = aerobus::expm1<aerobus::i64, 13>;
+    // |x| < 0.01 grows to about 0.0107 through the nesting : smallest degree reaching double precision
+    using EXP = aerobus::taylor_for<aerobus::i64, aerobus::internal::exp_coeff, double,
+        aerobus::make_q64_t<11, 1000>, aerobus::make_q64_t<1, 1000000000000000000>>;
+    using EXPM1 = aerobus::pq64::sub_t<EXP::type, aerobus::pq64::one>;
     return EXPM1::eval(EXPM1::eval(EXPM1::eval(EXPM1::eval(EXPM1::eval(EXPM1::eval(
                 EXPM1::eval(EXPM1::eval(EXPM1::eval(EXPM1::eval(EXPM1::eval(EXPM1::eval(x))))))))))));
 }
@@ -112,6 +115,354 @@ static void BM_std_sin_12(benchmark::State &state) {
 }
 
 
+static void BM_aero_sin_double(benchmark::State &state) {
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-10.0, 10.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = aerobus::libm::sin(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_std_sin_double(benchmark::State &state) {
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-10.0, 10.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = ::sin(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_sin_n_double(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-10.0, 10.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::sin_n(in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_sin_n_float(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    float *in = aerobus::aligned_malloc<float>(state.range(0), 64);
+    float *out = aerobus::aligned_malloc<float>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = static_cast<float>(rand(-10.0, 10.0));
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::sin_n(in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_sin_n_float_ulp4(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    float *in = aerobus::aligned_malloc<float>(state.range(0), 64);
+    float *out = aerobus::aligned_malloc<float>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = static_cast<float>(rand(-10.0, 10.0));
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::sin_n<float, aerobus::libm::accuracy::ulp4>(
+                in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_sin_n_float_approx_1e4(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    float *in = aerobus::aligned_malloc<float>(state.range(0), 64);
+    float *out = aerobus::aligned_malloc<float>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = static_cast<float>(rand(-10.0, 10.0));
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::sin_n<float, aerobus::libm::accuracy::approx_1e4>(
+                in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_sin_n_double_huge(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(1e6, 1e9);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::sin_n(in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_std_exp_double(benchmark::State &state) {
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-700.0, 700.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = ::exp(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_exp_double(benchmark::State &state) {
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-700.0, 700.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = aerobus::libm::exp(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_exp_n_double(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-700.0, 700.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::exp_n(in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_std_expm1_double(benchmark::State &state) {
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-10.0, 10.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = ::expm1(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_expm1_n_double(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-10.0, 10.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::expm1_n(in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_std_log_double(benchmark::State &state) {
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(1e-3, 1e3);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = ::log(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_log_n_double(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(1e-3, 1e3);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::log_n(in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_std_atan2_double(benchmark::State &state) {
+    double *y = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *x = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        y[i] = rand(-10.0, 10.0);
+        x[i] = rand(-10.0, 10.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = ::atan2(y[i], x[i]);
+        }
+    }
+
+    free(y);
+    free(x);
+    free(out);
+}
+
+static void BM_aero_atan2_n_double(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    double *y = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *x = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        y[i] = rand(-10.0, 10.0);
+        x[i] = rand(-10.0, 10.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::atan2_n(y + i, x + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(y);
+    free(x);
+    free(out);
+}
+
+static void BM_aero_sin_cos_n_double(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out_sin = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out_cos = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-10.0, 10.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::sin_n(in + i, out_sin + i, std::min(chunk, state.range(0) - i));
+            aerobus::libm::cos_n(in + i, out_cos + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out_sin);
+    free(out_cos);
+}
+
+static void BM_aero_sincos_n_double(benchmark::State &state) {
+    constexpr int64_t chunk = 1 << 10;
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out_sin = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out_cos = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-10.0, 10.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            aerobus::libm::sincos_n(in + i, out_sin + i, out_cos + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out_sin);
+    free(out_cos);
+}
+
 static void BM_aero_cos_12(benchmark::State &state) {
     using constants = aerobus::arithmetic_helpers<float>;
     float *in = aerobus::aligned_malloc<float>(state.range(0), 64);
@@ -170,6 +521,80 @@ static void BM_aero_hermite(benchmark::State &state) {
     free(out);
 }
 
+// sum of the first 12 hermite polynomials : one eval per polynomial vs eval_many
+static void BM_aero_hermite_family(benchmark::State &state) {
+    using namespace aerobus::known_polynomials;  // NOLINT
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-0.01, 0.01);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            const double x = in[i];
+            out[i] = hermite_phys<0>::eval(x) + hermite_phys<1>::eval(x) + hermite_phys<2>::eval(x) +
+                hermite_phys<3>::eval(x) + hermite_phys<4>::eval(x) + hermite_phys<5>::eval(x) +
+                hermite_phys<6>::eval(x) + hermite_phys<7>::eval(x) + hermite_phys<8>::eval(x) +
+                hermite_phys<9>::eval(x) + hermite_phys<10>::eval(x) + hermite_phys<11>::eval(x);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_hermite_family_eval_many(benchmark::State &state) {
+    using namespace aerobus::known_polynomials;  // NOLINT
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-0.01, 0.01);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            const auto h = aerobus::eval_many<hermite_phys<0>, hermite_phys<1>, hermite_phys<2>, hermite_phys<3>,
+                hermite_phys<4>, hermite_phys<5>, hermite_phys<6>, hermite_phys<7>, hermite_phys<8>,
+                hermite_phys<9>, hermite_phys<10>, hermite_phys<11>>(in[i]);
+            double sum = 0.0;
+            for (double v : h) {
+                sum += v;
+            }
+            out[i] = sum;
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_aero_hermite_family_recurrence(benchmark::State &state) {
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-0.01, 0.01);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            double h[12];
+            aerobus::known_polynomials::hermite_phys_all<11>(in[i], h);
+            double sum = 0.0;
+            for (double v : h) {
+                sum += v;
+            }
+            out[i] = sum;
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
 static void BM_std_hermite(benchmark::State &state) {
     double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
     double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
@@ -188,6 +613,26 @@ static void BM_std_hermite(benchmark::State &state) {
     free(out);
 }
 
+static void BM_horner_float(benchmark::State &state) {
+    using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+
+    float *in = aerobus::aligned_malloc<float>(state.range(0), 64);
+    float *out = aerobus::aligned_malloc<float>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(0.9, 1.1);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = P::eval(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
 static void BM_compensated_horner_float(benchmark::State &state) {
     using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
 
@@ -207,6 +652,131 @@ static void BM_compensated_horner_float(benchmark::State &state) {
     free(in);
     free(out);
 }
+
+static void BM_compensated_horner_float_eval_n(benchmark::State &state) {
+    using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+    constexpr int64_t chunk = 1 << 10;
+
+    float *in = aerobus::aligned_malloc<float>(state.range(0), 64);
+    float *out = aerobus::aligned_malloc<float>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(0.9, 1.1);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            P::compensated_eval_n(in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+// odd taylor expansion : eval folds it in x^2
+static void BM_taylor_sin_double(benchmark::State &state) {
+    using P = aerobus::sin<aerobus::i64, 17>;
+
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-1.0, 1.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = P::eval(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_std_tanh_double(benchmark::State &state) {
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-1.0, 1.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = std::tanh(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+// [7/6] pade approximant : both chains folded in x^2 and interleaved, one division
+static void BM_pade_tanh_double(benchmark::State &state) {
+    using P = aerobus::pade_t<aerobus::i64, aerobus::internal::tanh_coeff, 7, 6>;
+
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(-1.0, 1.0);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = P::eval(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+// newton step x - P(x) / P'(x) : two horner passes vs one sweep
+static void BM_newton_step_double(benchmark::State &state) {
+    using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+    using DP = aerobus::pi64::derive_t<P>;
+
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(0.9, 1.1);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = in[i] - P::eval(in[i]) / DP::eval(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_newton_step_double_eval_with_derivatives(benchmark::State &state) {
+    using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(0.9, 1.1);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            auto d = P::eval_with_derivatives<1>(in[i]);
+            out[i] = in[i] - d[0] / d[1];
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
 static void BM_horner_double(benchmark::State &state) {
     using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
 
@@ -227,20 +797,132 @@ static void BM_horner_double(benchmark::State &state) {
     free(out);
 }
 
+// same polynomial re-centred on 1 : (x - 1)^11 shifted by 1 is x^11, a power chain, and well conditioned
+static void BM_horner_double_shifted(benchmark::State &state) {
+    using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+    using S = aerobus::pi64::shift_t<P, aerobus::i64::one>;
+
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(0.9, 1.1);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = S::eval(in[i] - 1.0);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+static void BM_horner_double_eval_n(benchmark::State &state) {
+    using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+    constexpr int64_t chunk = 1 << 10;
+
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(0.9, 1.1);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            P::eval_n(in + i, out + i, std::min(chunk, state.range(0) - i));
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
+// uniform grid on [0.9, 1.1] : forward differences vs horner on materialized points
+static void BM_horner_double_eval_grid(benchmark::State &state) {
+    using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+    constexpr int64_t chunk = 1 << 10;
+
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    const double step = 0.2 / static_cast<double>(state.range(0));
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); i += chunk) {
+            P::eval_grid(0.9 + static_cast<double>(i) * step, step, std::min(chunk, state.range(0) - i), out + i);
+        }
+    }
+
+    free(out);
+}
+
+static void BM_estrin_double(benchmark::State &state) {
+    using P = aerobus::make_int_polynomial_t<aerobus::i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+
+    double *in = aerobus::aligned_malloc<double>(state.range(0), 64);
+    double *out = aerobus::aligned_malloc<double>(state.range(0), 64);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        in[i] = rand(0.9, 1.1);
+    }
+    for (auto _ : state) {
+        #pragma omp parallel for
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            out[i] = P::eval_estrin(in[i]);
+        }
+    }
+
+    free(in);
+    free(out);
+}
+
 BENCHMARK(BM_std_cos_12)->Range(1 << 10, 1 << 24);
 BENCHMARK(BM_aero_cos_12)->Range(1 << 10, 1 << 24);
 
 BENCHMARK(BM_std_sin_12)->Range(1 << 10, 1 << 24);
 BENCHMARK(BM_aero_sin_12)->Range(1 << 10, 1 << 24);
 BENCHMARK(BM_aero_fast_sin_12)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_std_sin_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_sin_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_sin_n_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_sin_n_double_huge)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_sin_n_float)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_sin_n_float_ulp4)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_sin_n_float_approx_1e4)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_sin_cos_n_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_sincos_n_double)->Range(1 << 10, 1 << 24);
 
 BENCHMARK(BM_std_expm1_12)->Range(1 << 10, 1 << 24);
 BENCHMARK(BM_aero_expm1_12)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_std_exp_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_exp_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_exp_n_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_std_expm1_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_expm1_n_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_std_log_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_log_n_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_std_atan2_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_atan2_n_double)->Range(1 << 10, 1 << 24);
 
 BENCHMARK(BM_std_hermite)->Range(1 << 10, 1 << 24);
 BENCHMARK(BM_aero_hermite)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_hermite_family)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_hermite_family_eval_many)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_aero_hermite_family_recurrence)->Range(1 << 10, 1 << 24);
 
 BENCHMARK(BM_horner_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_horner_double_shifted)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_horner_double_eval_n)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_horner_double_eval_grid)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_estrin_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_taylor_sin_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_std_tanh_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_pade_tanh_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_newton_step_double)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_newton_step_double_eval_with_derivatives)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_horner_float)->Range(1 << 10, 1 << 24);
 BENCHMARK(BM_compensated_horner_float)->Range(1 << 10, 1 << 24);
+BENCHMARK(BM_compensated_horner_float_eval_n)->Range(1 << 10, 1 << 24);
 
 BENCHMARK_MAIN();
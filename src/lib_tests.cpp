@@ -5,6 +5,7 @@
 #include <cstdio>
 #include <typeinfo>
 #include <array>
+#include <vector>
 #include <cmath>
 #include <cstdlib>
 #include <bitset>
@@ -57,6 +58,106 @@ TEST(polynomials, eval) {
     EXPECT_EQ(vvvv, -1.0);
 }
 
+TEST(polynomials, eval_parity_fold) {
+    // x^4 - 3x^2 + 2 is even, 2x^5 + x is odd, x^3 + x^2 is neither
+    using E = make_int_polynomial_t<i64, 1, 0, -3, 0, 2>;
+    using O = make_int_polynomial_t<i64, 2, 0, 0, 0, 1, 0>;
+    using N = make_int_polynomial_t<i64, 1, 1, 0, 0>;
+    static_assert(aerobus::internal::parity_fold<E>::value && aerobus::internal::parity_fold<E>::is_even);
+    static_assert(aerobus::internal::parity_fold<O>::value && aerobus::internal::parity_fold<O>::is_odd);
+    static_assert(!aerobus::internal::parity_fold<N>::value);
+    using EH = aerobus::internal::parity_fold<E>::half_t;
+    using OH = aerobus::internal::parity_fold<O>::half_t;
+    static_assert(std::is_same_v<EH, make_int_polynomial_t<i64, 1, -3, 2>>);
+    static_assert(std::is_same_v<OH, make_int_polynomial_t<i64, 2, 0, 1>>);
+    constexpr int64_t e = E::eval(int64_t(3));
+    constexpr int64_t o = O::eval(int64_t(-3));
+    static_assert(e == 56 && o == -489);
+
+    // taylor expansions : folded evaluation agrees with the unfolded horner scheme
+    using S = aerobus::sin<i64, 13>;
+    using C = aerobus::cos<i64, 12>;
+    static_assert(aerobus::internal::parity_fold<S>::is_odd && aerobus::internal::parity_fold<C>::is_even);
+    static_assert(aerobus::internal::parity_fold<S>::half_t::degree == 6);
+    constexpr auto sc = []<size_t... I>(std::index_sequence<I...>) {
+        return std::array<double, sizeof...(I)> {S::template coeff_at_t<I>::template get<double>()...};
+    }(std::make_index_sequence<14>());
+    constexpr auto cc = []<size_t... I>(std::index_sequence<I...>) {
+        return std::array<double, sizeof...(I)> {C::template coeff_at_t<I>::template get<double>()...};
+    }(std::make_index_sequence<14>());
+    double xs[33], ys[33];
+    for (int i = 0; i <= 32; ++i) {
+        const double x = -0.8 + 0.05 * i;
+        xs[i] = x;
+        double s = 0.0, c = 0.0;
+        for (int k = 13; k >= 0; --k) {
+            s = s * x + sc[k];
+            c = c * x + cc[k];
+        }
+        EXPECT_NEAR(S::eval(x), s, 2 * std::numeric_limits<double>::epsilon());
+        EXPECT_NEAR(C::eval(x), c, 2 * std::numeric_limits<double>::epsilon());
+    }
+    S::eval_n(xs, ys, 33);
+    for (int i = 0; i <= 32; ++i) {
+        EXPECT_NEAR(ys[i], S::eval(xs[i]), std::numeric_limits<double>::epsilon());
+    }
+}
+
+TEST(polynomials, eval_sparse) {
+    // 2x^11 - x^10 + 3x + 1 : runs of zeros are skipped with x^8, dense x^3 + 1 is kept as is
+    using S = make_int_polynomial_t<i64, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1>;
+    using D = make_int_polynomial_t<i64, 1, 0, 0, 1>;
+    using schedule = aerobus::internal::sparse_schedule<S>;
+    static_assert(schedule::value && schedule::count == 4);
+    static_assert(schedule::exponents[0] == 11 && schedule::exponents[1] == 10 && schedule::exponents[3] == 0);
+    static_assert(!aerobus::internal::sparse_schedule<D>::value);
+    // x^7 (odd) and x^10 + x^3 : trailing power and shared chains
+    using M = make_int_polynomial_t<i64, 1, 0, 0, 0, 0, 0, 0, 0>;
+    using T = make_int_polynomial_t<i64, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0>;
+    static_assert(aerobus::internal::sparse_schedule<T>::value);
+    constexpr int64_t s = S::eval(int64_t(2));
+    constexpr int64_t m = M::eval(int64_t(-3));
+    constexpr int64_t t = T::eval(int64_t(3));
+    static_assert(s == 3079 && m == -2187 && t == 59076);
+
+    double xs[37], ys[37];
+    for (int i = 0; i < 37; ++i) {
+        xs[i] = -1.8 + 0.1 * i;
+        const double x = xs[i];
+        const double expected = 2 * std::pow(x, 11) - std::pow(x, 10) + 3 * x + 1;
+        EXPECT_NEAR(S::eval(x), expected, 8 * std::numeric_limits<double>::epsilon() * (1 + std::fabs(expected)));
+    }
+    S::eval_n(xs, ys, 37);
+    for (int i = 0; i < 37; ++i) {
+        EXPECT_NEAR(ys[i], S::eval(xs[i]), 2 * std::numeric_limits<double>::epsilon() * (1 + std::fabs(ys[i])));
+    }
+}
+
+TEST(polynomials, eval_estrin) {
+    // 1 + 2x + 3x^2
+    using poly = polynomial<i32>::val<i32::val<3>, i32::val<2>, i32::val<1>>;
+    constexpr int v = poly::eval_estrin(2);
+    EXPECT_EQ(v, 17);
+
+    // integer coefficients : estrin and horner are both exact
+    using P5 = make_int_polynomial_t<i64, 1, -5, 10, -10, 5, -1>;
+    using P8 = make_int_polynomial_t<i64, 2, 0, -3, 7, 1, -1, 4, 0, 9>;
+    using P11 = make_int_polynomial_t<i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+    for (int64_t x = -4; x <= 4; ++x) {
+        EXPECT_EQ(P5::eval_estrin(x), P5::eval(x));
+        EXPECT_EQ(P8::eval_estrin(x), P8::eval(x));
+        EXPECT_EQ(P11::eval_estrin(x), P11::eval(x));
+    }
+
+    constexpr double c = polynomial<i32>::val<i32::val<7>>::eval_estrin(3.0);
+    EXPECT_EQ(c, 7.0);
+
+    using EXPM1 = aerobus::expm1<i64, 13>;
+    for (double x = -0.5; x <= 0.5; x += 0.01) {
+        EXPECT_NEAR(EXPM1::eval_estrin(x), EXPM1::eval(x), 4 * std::numeric_limits<double>::epsilon());
+    }
+}
+
 TEST(polynomials, compensated_eval) {
     // 1 + 2x + 3x^2
     using poly = make_int_polynomial_t<i32, 3, 2, 1>;
@@ -70,6 +171,251 @@ TEST(polynomials, compensated_eval) {
 
     double vvvv = polyf::compensated_eval(-1.0);
     EXPECT_EQ(vvvv, -1.0);
+
+    // high degree : single pass, error terms carried in registers
+    using E = aerobus::expm1<i64, 20>;
+    double in[64], out[64];
+    for (size_t i = 0; i < 64; ++i) {
+        in[i] = -0.5 + static_cast<double>(i) / 64.0;
+        const double expected = std::expm1(in[i]);
+        const double tolerance = 2 * std::numeric_limits<double>::epsilon() * std::fabs(expected);
+        EXPECT_NEAR(E::compensated_eval(in[i]), expected, tolerance);
+    }
+    E::compensated_eval_n(in, out, 64);
+    for (size_t i = 0; i < 64; ++i) {
+        EXPECT_NEAR(out[i], E::compensated_eval(in[i]), 2 * std::numeric_limits<double>::epsilon() * std::fabs(out[i]));
+    }
+}
+
+TEST(polynomials, compensated_eval_ill_conditioned) {
+    // (x - 1)^7 near 1 : horner loses most digits, compensated horner is as accurate as in twice the precision
+    // catches error free transformations broken by fma contraction
+    using P7 = make_int_polynomial_t<i64, 1, -7, 21, -35, 35, -21, 7, -1>;
+    double in[32], out[32];
+    float fin[32];
+    for (size_t i = 0; i < 32; ++i) {
+        const double d = (i < 16 ? -1.0 : 1.0) * (0.005 + 0.001 * static_cast<double>(i % 16));
+        in[i] = 1.0 + d;
+        // in - 1 is exact (Sterbenz), its 7th power is correct within a few ulps
+        const double e = in[i] - 1.0;
+        const double exact = e * e * e * e * e * e * e;
+        EXPECT_NEAR(P7::compensated_eval(in[i]), exact, 1E-12 * std::fabs(exact)) << std::hexfloat << in[i];
+        fin[i] = 1.0F + (i < 16 ? -1.0F : 1.0F) * (0.1F + 0.01F * static_cast<float>(i % 16));
+        const double fe = static_cast<double>(fin[i]) - 1.0;
+        const double fexact = fe * fe * fe * fe * fe * fe * fe;
+        EXPECT_NEAR(P7::compensated_eval(fin[i]), fexact, 1E-4 * std::fabs(fexact)) << std::hexfloat << fin[i];
+    }
+    P7::compensated_eval_n(in, out, 32);
+    for (size_t i = 0; i < 32; ++i) {
+        EXPECT_NEAR(out[i], P7::compensated_eval(in[i]), 1E-12 * std::fabs(out[i])) << std::hexfloat << in[i];
+    }
+
+    // error free transformations are exact
+    double x, y;
+    aerobus::internal::two_prod(1.0 + 0x1p-30, 1.0 - 0x1p-30, &x, &y);
+    EXPECT_EQ(x, 1.0);
+    EXPECT_EQ(y, -0x1p-60);
+    aerobus::internal::two_sum(1.0, 0x1p-60, &x, &y);
+    EXPECT_EQ(x, 1.0);
+    EXPECT_EQ(y, 0x1p-60);
+    float fx, fy;
+    aerobus::internal::two_prod(1.0F + 0x1p-13F, 1.0F - 0x1p-13F, &fx, &fy);
+    EXPECT_EQ(fx, 1.0F);
+    EXPECT_EQ(fy, -0x1p-26F);
+}
+
+TEST(polynomials, eval_n) {
+    // (x-1)^11, exact on small integers
+    using P = make_int_polynomial_t<i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+    constexpr size_t n = 1027;
+    double *in = aerobus::aligned_malloc<double>(n + 8, 64);
+    double *out = aerobus::aligned_malloc<double>(n + 8, 64);
+    for (size_t i = 0; i < n + 8; ++i) {
+        in[i] = static_cast<double>(static_cast<int64_t>(i % 7) - 3);
+    }
+    // aligned, misaligned input, misaligned output, both misaligned, empty
+    for (size_t in_offset : {0, 1, 3}) {
+        for (size_t out_offset : {0, 1, 5}) {
+            P::eval_n(in + in_offset, out + out_offset, n);
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(out[out_offset + i], P::eval(in[in_offset + i]));
+            }
+        }
+    }
+    P::eval_n(in, out, 0);
+    // in place
+    P::eval_n(in, in, n);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(in[i], P::eval(static_cast<double>(static_cast<int64_t>(i % 7) - 3)));
+    }
+    free(in);
+    free(out);
+
+    using E = aerobus::expm1<i64, 13>;
+    float fin[133], fout[133], fcomp[133];
+    for (size_t i = 0; i < 133; ++i) {
+        fin[i] = -0.5F + static_cast<float>(i) / 133.0F;
+    }
+    E::eval_n(fin + 1, fout + 1, 132);
+    E::compensated_eval_n(fin + 1, fcomp + 1, 132);
+    for (size_t i = 1; i < 133; ++i) {
+        EXPECT_NEAR(fout[i], E::eval(fin[i]), 4 * std::numeric_limits<float>::epsilon());
+        EXPECT_NEAR(fcomp[i], E::compensated_eval(fin[i]), 2 * std::numeric_limits<float>::epsilon());
+    }
+}
+
+TEST(polynomials, eval_with_derivatives) {
+    // (x-1)^5 + 3x, exact on small integers
+    using P = make_int_polynomial_t<i64, 1, -5, 10, -10, 8, -1>;
+    using P1 = pi64::derive_t<P>;
+    using P2 = pi64::derive_t<P1>;
+    using P3 = pi64::derive_t<P2>;
+    for (int i = -4; i <= 4; ++i) {
+        const double x = static_cast<double>(i);
+        auto d = P::eval_with_derivatives<3>(x);
+        EXPECT_EQ(d[0], P::eval(x));
+        EXPECT_EQ(d[1], P1::eval(x));
+        EXPECT_EQ(d[2], P2::eval(x));
+        EXPECT_EQ(d[3], P3::eval(x));
+    }
+    // more derivatives than degree, constants
+    constexpr auto q = pi64::X::eval_with_derivatives<3>(2.0);
+    static_assert(q[0] == 2.0 && q[1] == 1.0 && q[2] == 0.0 && q[3] == 0.0);
+    constexpr auto c = pi64::one::eval_with_derivatives<1>(2.0);
+    static_assert(c[0] == 1.0 && c[1] == 0.0);
+
+    // batched : aligned and misaligned, float and double
+    using E = aerobus::expm1<i64, 11>;
+    constexpr size_t n = 133;
+    double in[n + 1], v[n + 1], d1[n + 1], d2[n + 1];
+    float fin[n + 1], fv[n + 1], fd1[n + 1];
+    for (size_t i = 0; i <= n; ++i) {
+        in[i] = -0.5 + static_cast<double>(i) / n;
+        fin[i] = static_cast<float>(in[i]);
+    }
+    for (size_t offset : {0, 1}) {
+        double* out[3] = {v + offset, d1 + offset, d2 + offset};
+        E::eval_with_derivatives_n<2>(in + offset, out, n - offset);
+        float* fout[2] = {fv + offset, fd1 + offset};
+        E::eval_with_derivatives_n<1>(fin + offset, fout, n - offset);
+        for (size_t i = offset; i < n; ++i) {
+            auto d = E::eval_with_derivatives<2>(in[i]);
+            EXPECT_DOUBLE_EQ(v[i], d[0]);
+            EXPECT_DOUBLE_EQ(d1[i], d[1]);
+            EXPECT_DOUBLE_EQ(d2[i], d[2]);
+            auto fd = E::eval_with_derivatives<1>(fin[i]);
+            EXPECT_FLOAT_EQ(fv[i], fd[0]);
+            EXPECT_FLOAT_EQ(fd1[i], fd[1]);
+        }
+    }
+}
+
+TEST(polynomials, eval_many) {
+    // families : every member is even or odd
+    using namespace known_polynomials;  // NOLINT
+    for (int i = -10; i <= 10; ++i) {
+        const double x = 0.19 * i;
+        auto h = eval_many<hermite_phys<0>, hermite_phys<1>, hermite_phys<2>, hermite_phys<3>, hermite_phys<4>,
+                           hermite_phys<5>, hermite_phys<6>, hermite_phys<7>, hermite_phys<8>, hermite_phys<9>>(x);
+        EXPECT_EQ(h[0], 1.0);
+        EXPECT_NEAR(h[3], hermite_phys<3>::eval(x), 1e-12 * (1 + std::fabs(h[3])));
+        EXPECT_NEAR(h[8], hermite_phys<8>::eval(x), 1e-12 * (1 + std::fabs(h[8])));
+        EXPECT_NEAR(h[9], hermite_phys<9>::eval(x), 1e-12 * (1 + std::fabs(h[9])));
+        const float xf = static_cast<float>(x) / 2;
+        auto l = eval_many<legendre<1>, legendre<2>, legendre<3>, legendre<4>, legendre<5>, legendre<6>,
+                           legendre<7>, legendre<8>, legendre<9>, legendre<10>, legendre<11>>(xf);
+        EXPECT_NEAR(l[0], xf, 1e-6F);
+        EXPECT_NEAR(l[4], legendre<5>::eval(xf), 1e-6F);
+        EXPECT_NEAR(l[10], legendre<11>::eval(xf), 1e-6F);
+    }
+
+    // unrelated polynomials, neither even nor odd, different rings and degrees
+    using A = make_int_polynomial_t<i64, 1, -5, 10, -10, 5, -1>;
+    using B = make_int_polynomial_t<i32, 3, 1>;
+    using C = polynomial<q64>::val<make_q64_t<1, 2>, make_q64_t<-1, 3>, make_q64_t<1, 4>>;
+    for (int i = -10; i <= 10; ++i) {
+        const double x = 0.3 * i;
+        auto r = eval_many<A, B, C>(x);
+        EXPECT_NEAR(r[0], A::eval(x), 1e-12 * (1 + std::fabs(r[0])));
+        EXPECT_DOUBLE_EQ(r[1], B::eval(x));
+        EXPECT_DOUBLE_EQ(r[2], C::eval(x));
+    }
+    // constant evaluation, one polynomial
+    constexpr auto c = eval_many<A, B, hermite_phys<2>>(int64_t(3));
+    static_assert(c[0] == 32 && c[1] == 10 && c[2] == 34);
+    constexpr auto one = eval_many<B>(2.0);
+    static_assert(one[0] == 7.0);
+}
+
+TEST(polynomials, compose) {
+    // (x^2 + 1) o (x - 1) = x^2 - 2x + 2
+    using P = make_int_polynomial_t<i64, 1, 0, 1>;
+    using Q = make_int_polynomial_t<i64, 1, -1>;
+    EXPECT_TRUE((std::is_same_v<pi64::compose_t<P, Q>, make_int_polynomial_t<i64, 1, -2, 2>>));
+
+    // taylor shift : (x - 3)^3 shifted by 3 is x^3
+    using C = make_int_polynomial_t<i64, 1, -9, 27, -27>;
+    EXPECT_TRUE((std::is_same_v<pi64::shift_t<C, i64::val<3>>, make_int_polynomial_t<i64, 1, 0, 0, 0>>));
+
+    // re-centred legendre polynomial, exact over rationals
+    using L = known_polynomials::legendre<6>;
+    using LS = pq64::shift_t<L, make_q64_t<1, 2>>;
+    for (int i = -10; i <= 10; ++i) {
+        const double x = 0.1 * i;
+        EXPECT_NEAR(LS::eval(x - 0.5), L::eval(x), 1E-13);
+    }
+}
+
+TEST(polynomials, fold) {
+    static_assert(internal::eval_cost<aerobus::sin<i64, 17>>::value == 10);
+
+    // dense polynomial of an affine map : folding saves one fma
+    using R = make_int_polynomial_t<i64, 3, 1, 0, 2, 5>;
+    using A = make_int_polynomial_t<i64, 2, -1>;
+    static_assert(internal::fold_cost<R, A>::value);
+    EXPECT_TRUE((std::is_same_v<fold_t<R, A>, pi64::compose_t<R, A>>));
+    EXPECT_EQ((fold_t<R, A>::eval(0.75)), R::eval(0.5));
+
+    // degrees multiply : expm1 chains stay nested (and their composition is never computed)
+    using E = aerobus::expm1<i64, 7>;
+    static_assert(!internal::fold_cost<E, E>::value);
+    using EEE = fold_t<E, E, E>;
+    EXPECT_NEAR(EEE::eval(0.01), E::eval(E::eval(E::eval(0.01))), 1E-18);
+}
+
+TEST(polynomials, eval_grid) {
+    // errors are measured against sum |a_i| |x|^i, the condition of the evaluation
+    using P = make_int_polynomial_t<i64, 3, -7, 2, 5, -1, 4>;
+    using Q = make_int_polynomial_t<i64, 1, -11, 55, -165, 330, -462, 462, -330, 165, -55, 11, -1>;
+    constexpr size_t n = 4099;
+    std::vector<double> out(n);
+    std::vector<float> fout(n);
+    for (double x0 : {-1.0, 0.25}) {
+        const double step = 1.5 / n;
+        P::eval_grid(x0, step, n, out.data());
+        for (size_t i = 0; i < n; ++i) {
+            const double x = std::fma(static_cast<double>(i), step, x0);
+            const double ax = std::fabs(x);
+            const double cond = ((((3 * ax + 7) * ax + 2) * ax + 5) * ax + 1) * ax + 4;
+            EXPECT_NEAR(out[i], P::eval(x), 16 * std::numeric_limits<double>::epsilon() * cond);
+        }
+        Q::eval_grid<4>(x0, step, n, out.data());
+        for (size_t i = 0; i < n; ++i) {
+            const double x = std::fma(static_cast<double>(i), step, x0);
+            const double cond = std::pow(1 + std::fabs(x), 11);
+            EXPECT_NEAR(out[i], Q::eval(x), 16 * std::numeric_limits<double>::epsilon() * cond);
+        }
+        P::eval_grid(static_cast<float>(x0), static_cast<float>(step), n, fout.data());
+        for (size_t i = 0; i < n; ++i) {
+            const float x = std::fma(static_cast<float>(i), static_cast<float>(step), static_cast<float>(x0));
+            EXPECT_NEAR(fout[i], P::eval(x), 1e-5F * (1 + std::fabs(P::eval(x))));
+        }
+    }
+    // constants, short grids
+    polynomial<i64>::val<i64::val<3>>::eval_grid(0.0, 1.0, 5, out.data());
+    EXPECT_EQ(out[4], 3.0);
+    P::eval_grid(1.0, 1.0, 3, out.data());
+    EXPECT_EQ(out[2], P::eval(3.0));
 }
 
 TEST(fraction_field, get) {
@@ -109,6 +455,20 @@ TEST(polynomials, coeff_at) {
     EXPECT_TRUE((std::is_same_v<at3, i32::val<0>>));
 }
 
+TEST(polynomials, coefficients) {
+    // 1 + 2x + 3x^2
+    using poly = polynomial<i32>::val<i32::val<3>, i32::val<2>, i32::val<1>>;
+    constexpr auto c = poly::coefficients<double>;
+    static_assert(c.size() == 3 && c[0] == 1.0 && c[1] == 2.0 && c[2] == 3.0);
+    static_assert(polynomial<i32>::one::coefficients<float>[0] == 1.0F);
+    // 1/2 - x/3
+    using polyq = polynomial<q32>::val<make_q32_t<-1, 3>, make_q32_t<1, 2>>;
+    EXPECT_EQ(polyq::coefficients<float>[0], 0.5F);
+    EXPECT_EQ(polyq::coefficients<float>[1], -1.0F / 3.0F);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(poly::coefficients<double>.data()) % 64, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(polyq::coefficients<float>.data()) % 64, 0);
+}
+
 template<typename... coeffs>
 using IX = polynomial<i32>::val<coeffs...>;
 template<int32_t x>
@@ -742,6 +1102,135 @@ TEST(utilities, expm1_long_double) {
     EXPECT_TRUE((std::abs(std::expm1(0.1) - e01) <= 1E-7));
 }
 
+TEST(utilities, pade) {
+    // exp [2/2] = (1 + x/2 + x^2/12) / (1 - x/2 + x^2/12)
+    using E = pade_t<i64, internal::exp_coeff, 2, 2>;
+    using N = pq64::val<make_q64_t<1, 12>, make_q64_t<1, 2>, q64::one>;
+    using D = pq64::val<make_q64_t<1, 12>, make_q64_t<-1, 2>, q64::one>;
+    EXPECT_TRUE((std::is_same_v<E::x, N>));
+    EXPECT_TRUE((std::is_same_v<E::y, D>));
+    constexpr double e1 = E::eval(1.0);
+    EXPECT_NEAR(e1, 19.0 / 7.0, 1E-15);
+
+    // odd function : numerator odd, denominator even
+    using T = pade_t<i64, internal::tanh_coeff, 5, 4>;
+    EXPECT_EQ(T::x::degree, 5);
+    EXPECT_EQ(T::y::degree, 4);
+    EXPECT_TRUE((T::x::coeff_at_t<0>::is_zero_v && T::y::coeff_at_t<1>::is_zero_v));
+
+    // [5/4] beats the taylor polynomial of the same total degree by orders of magnitude
+    using TT = aerobus::tanh<i64, 9>;
+    double pade_err = 0, taylor_err = 0;
+    for (int i = -100; i <= 100; ++i) {
+        const double x = i / 100.0;
+        pade_err = std::max(pade_err, std::abs(T::eval(x) - std::tanh(x)));
+        taylor_err = std::max(taylor_err, std::abs(TT::eval(x) - std::tanh(x)));
+    }
+    EXPECT_LE(pade_err, 1E-7);
+    EXPECT_LE(pade_err * 100, taylor_err);
+
+    using A = pade_t<i64, internal::atan_coeff, 5, 4>;
+    EXPECT_NEAR(A::eval(0.5), std::atan(0.5), 5E-7);
+}
+
+// cos(x^2) = sum (-1)^j x^(4j) / (2j)! : nonzero coefficients four apart
+template<typename T, size_t i, typename E = void>
+struct cos_x2_coeff_helper {
+    using type = typename FractionField<T>::zero;
+};
+
+template<typename T, size_t i>
+struct cos_x2_coeff_helper<T, i, std::enable_if_t<i % 4 == 0>> {
+    using type = makefraction_t<T, alternate_t<T, i / 4>, factorial_t<T, i / 2>>;
+};
+
+template<typename T, size_t i>
+struct cos_x2_coeff {
+    using type = typename cos_x2_coeff_helper<T, i>::type;
+};
+
+TEST(utilities, taylor_for) {
+    // exp on [-0.01, 0.01] : 0.01^8 / 8! < 1E-18 < 0.01^7 / 7! : degree 6 falls short, degree 7 is enough
+    using E = taylor_for<i64, internal::exp_coeff, double, make_q64_t<1, 100>, make_q64_t<1, 1000000000000000000>>;
+    static_assert(E::degree == 7);
+    static_assert(std::is_same_v<E::type, aerobus::exp<i64, 7>>);
+    EXPECT_LE(E::error_bound, 1E-18);
+    EXPECT_NEAR(E::eval(0.01), std::exp(0.01), 1E-16);
+
+    // exp on [-1, 1] : 1 / 20! < 1E-18 < 1 / 19!, and the search does not reach 21!, which overflows i64
+    using E1 = taylor_for<i64, internal::exp_coeff, double, make_q64_t<1, 1>, make_q64_t<1, 1000000000000000000>>;
+    static_assert(E1::degree == 19);
+    EXPECT_LE(E1::error_bound, 1E-18);
+    EXPECT_NEAR(E1::eval(1.0), std::exp(1.0), 1E-15);
+    EXPECT_NEAR(E1::eval(-1.0), std::exp(-1.0), 1E-16);
+
+    // odd series : degree stops on a nonzero term, and the bound holds
+    using S = taylor_for<i64, internal::sin_coeff, double, make_q64_t<1, 1>, make_q64_t<1, 1000000000>>;
+    static_assert(S::degree == 11);
+    double worst = 0.0;
+    for (int i = -1000; i <= 1000; ++i) {
+        const double x = i / 1000.0;
+        worst = std::max(worst, std::abs(S::eval(x) - std::sin(x)));
+    }
+    EXPECT_LE(worst, S::error_bound);
+    EXPECT_GE(worst, S::error_bound / 2);
+
+    // cos(x^2) on [-1, 1] : three zero coefficients after each kept term do not end the search.
+    // 1 / 12! > 1E-9 > 1 / 14! : x^24 is kept and x^28 is the first omitted term
+    using C = taylor_for<i64, cos_x2_coeff, double, make_q64_t<1, 1>, make_q64_t<1, 1000000000>>;
+    static_assert(C::degree == 24);
+    worst = 0.0;
+    for (int i = -1000; i <= 1000; ++i) {
+        const double x = i / 1000.0;
+        worst = std::max(worst, std::abs(C::eval(x) - std::cos(x * x)));
+    }
+    EXPECT_LE(worst, C::error_bound);
+    EXPECT_GE(worst, C::error_bound / 2);
+}
+
+template<typename T, size_t i>
+struct bell_coeff {
+    using type = makefraction_t<T, bell_t<T, i>, factorial_t<T, i>>;
+};
+
+TEST(utilities, power_series) {
+    using S = power_series<i64, 10>;
+    using E = S::from_taylor_t<internal::exp_coeff>;
+    using Sin = S::from_taylor_t<internal::sin_coeff>;
+    using Cos = S::from_taylor_t<internal::cos_coeff>;
+
+    // exp(exp(x) - 1) = sum B_n / n! x^n (bell numbers), see examples/custom_taylor.cpp
+    using EE = S::compose_t<E, S::sub_t<E, S::one>>;
+    EXPECT_TRUE((std::is_same_v<EE, S::from_taylor_t<bell_coeff>>));
+
+    // cos * (1 / cos) = 1, 1 / (1 - x) = sum x^k
+    EXPECT_TRUE((std::is_same_v<S::mul_t<Cos, S::inverse_t<Cos>>, S::one>));
+    using G = S::inverse_t<S::sub_t<S::one, S::X>>;
+    EXPECT_EQ(G::degree, 10);
+    EXPECT_TRUE((std::is_same_v<G::coeff_at_t<7>, q64::one>));
+
+    // functional inverses : asin and ln(1 + x)
+    EXPECT_TRUE((std::is_same_v<S::reversion_t<Sin>, S::from_taylor_t<internal::asin_coeff>>));
+    EXPECT_TRUE((std::is_same_v<S::reversion_t<S::sub_t<E, S::one>>, S::from_taylor_t<internal::lnp1_coeff>>));
+
+    // fused series evaluated as a single polynomial
+    using ES = S::compose_t<E, Sin>;
+    EXPECT_NEAR(ES::eval(0.1), std::exp(std::sin(0.1)), 1E-14);
+    using Sinc = S::div_t<Sin, S::X>;
+    EXPECT_EQ(Sinc::degree, 8);
+    EXPECT_NEAR(Sinc::eval(0.1), std::sin(0.1) / 0.1, 1E-15);
+
+    // x / sin(x) = 1 + x^2/6 + 7x^4/360 + 31x^6/15120 : at N = 6, x^6 is out of reach once x is cancelled
+    using S6 = power_series<i64, 6>;
+    using Csc = S6::div_t<S6::X, S6::from_taylor_t<internal::sin_coeff>>;
+    EXPECT_EQ(Csc::degree, 4);
+    EXPECT_TRUE((std::is_same_v<Csc::coeff_at_t<2>, make_q64_t<1, 6>>));
+    EXPECT_TRUE((std::is_same_v<Csc::coeff_at_t<4>, make_q64_t<7, 360>>));
+    using Csc8 = power_series<i64, 8>::div_t<power_series<i64, 8>::X,
+                                             power_series<i64, 8>::from_taylor_t<internal::sin_coeff>>;
+    EXPECT_TRUE((std::is_same_v<Csc8::coeff_at_t<6>, make_q64_t<31, 15120>>));
+}
+
 TEST(utilities, alternate) {
     constexpr int a0 = internal::alternate<i32, 0>::value;
     EXPECT_EQ(a0, 1);
@@ -816,6 +1305,43 @@ TEST(sollya, taylor_vs_remez) {
     EXPECT_TRUE((inf_remez < inf_taylor));
 }
 
+TEST(sollya, remez) {
+    // same problem as taylor_vs_remez, generated at compile time instead of pasted from sollya
+    constexpr auto f = [](auto x) { return aerobus::expm1<i64, 20>::eval(x); };
+    using R = internal::remez<decltype(f), make_q64_t<-1, 1>, make_q64_t<1, 1>, 0, 1, 2, 3, 4, 5, 6, 7, 8>;
+    using P = remez_t<q64, decltype(f), make_q64_t<-1, 1>, make_q64_t<1, 1>, 8>;
+    using P32 = remez_t<q32, decltype(f), make_q64_t<-1, 1>, make_q64_t<1, 1>, 8>;
+    using T = aerobus::expm1<i64, 8>;
+    EXPECT_EQ(P::degree, 8);
+    double inf_remez = 0.0, inf_taylor = 0.0, inf_remez32 = 0.0;
+    double lowest = 0.0;
+    for (int i = -1000; i <= 1000; ++i) {
+        const double x = 0.001 * i;
+        const double e = P::eval(x) - std::expm1(x);
+        inf_remez = std::max(inf_remez, std::abs(e));
+        inf_taylor = std::max(inf_taylor, std::abs(T::eval(x) - std::expm1(x)));
+        inf_remez32 = std::max(inf_remez32, std::abs(P32::eval(x) - std::expm1(x)));
+        lowest = std::min(lowest, e);
+    }
+    // equioscillation : the error reaches +/- its maximum
+    EXPECT_NEAR(inf_remez, static_cast<double>(R::value.error), 1E-3 * inf_remez);
+    EXPECT_NEAR(-lowest, inf_remez, 1E-3 * inf_remez);
+    EXPECT_LT(100 * inf_remez, inf_taylor);
+    // rounding to 32 bits rationals costs about float precision
+    EXPECT_LT(inf_remez32, inf_remez + 1E-7);
+
+    // odd monomials on [0, pi/4]
+    constexpr auto g = [](auto x) { return aerobus::sin<i64, 19>::eval(x); };
+    using S = remez_monomials_t<q64, decltype(g), make_q64_t<0, 1>,
+                                make_q64_t<7853981633974483, 10000000000000000>, 1, 3, 5, 7>;
+    EXPECT_EQ(S::degree, 7);
+    EXPECT_TRUE((S::coeff_at_t<0>::is_zero_v && S::coeff_at_t<2>::is_zero_v && S::coeff_at_t<6>::is_zero_v));
+    for (int i = -100; i <= 100; ++i) {
+        const double x = 0.0078539816 * i;
+        EXPECT_NEAR(S::eval(x), std::sin(x), 5E-9);
+    }
+}
+
 TEST(utilities, pow_scalar) {
     constexpr int32_t a0 = pow_scalar<int32_t, 2>(2);
     EXPECT_EQ(a0, 4);
@@ -1069,6 +1595,111 @@ TEST(known_polynomials, legendre) {
     }
 }
 
+TEST(known_polynomials, recurrences_all) {
+    using namespace known_polynomials;  // NOLINT
+    // small degrees : same values as horner on monomial coefficients
+    for (int i = -8; i <= 8; ++i) {
+        const double x = 0.11 * i;
+        double h[7], he[7], l[7], la[7], t[7], u[7];
+        hermite_phys_all<6>(x, h);
+        hermite_prob_all<6>(x, he);
+        legendre_all<6>(x, l);
+        laguerre_all<6>(x, la);
+        chebyshev_T_all<6>(x, t);
+        chebyshev_U_all<6>(x, u);
+        auto eh = eval_many<hermite_phys<0>, hermite_phys<1>, hermite_phys<2>, hermite_phys<5>, hermite_phys<6>>(x);
+        EXPECT_NEAR(h[0], eh[0], 1e-12);
+        EXPECT_NEAR(h[1], eh[1], 1e-12);
+        EXPECT_NEAR(h[2], eh[2], 1e-12);
+        EXPECT_NEAR(h[5], eh[3], 1e-12);
+        EXPECT_NEAR(h[6], eh[4], 1e-12);
+        EXPECT_NEAR(he[4], hermite_prob<4>::eval(x), 1e-12);
+        EXPECT_NEAR(l[1], x, 1e-15);
+        EXPECT_NEAR(l[5], legendre<5>::eval(x), 1e-14);
+        EXPECT_NEAR(la[1], laguerre<1>::eval(x), 1e-15);
+        EXPECT_NEAR(la[6], laguerre<6>::eval(x), 1e-13);
+        EXPECT_NEAR(t[1], x, 1e-15);
+        EXPECT_NEAR(t[6], chebyshev_T<6>::eval(x), 1e-14);
+        EXPECT_NEAR(u[1], 2 * x, 1e-15);
+        EXPECT_NEAR(u[6], chebyshev_U<6>::eval(x), 1e-14);
+    }
+    constexpr auto t3 = [] {
+        std::array<int64_t, 4> t {};
+        chebyshev_T_all<3>(int64_t(2), t.data());
+        return t;
+    }();
+    static_assert(t3[0] == 1 && t3[1] == 2 && t3[2] == 7 && t3[3] == 26);
+
+    // high degrees, where monomial coefficients are useless : T_n(cos a) = cos(n a), P_n(1) = 1
+    double t[201], l[201];
+    for (double a : {0.1, 1.0, 2.5}) {
+        chebyshev_T_all<200>(std::cos(a), t);
+        for (size_t n = 0; n <= 200; n += 10) {
+            EXPECT_NEAR(t[n], std::cos(static_cast<double>(n) * a), 1e-11);
+        }
+    }
+    legendre_all<200>(1.0, l);
+    EXPECT_NEAR(l[200], 1.0, 1e-12);
+    legendre_all<200>(-1.0, l);
+    EXPECT_NEAR(l[199], -1.0, 1e-12);
+
+    // batched, vectorized over x
+    constexpr size_t n = 37;
+    double in[n], o0[n], o1[n], o2[n], o3[n], o4[n];
+    double* out[5] = {o0, o1, o2, o3, o4};
+    for (size_t i = 0; i < n; ++i) {
+        in[i] = -0.9 + 0.05 * static_cast<double>(i);
+    }
+    legendre_all_n<4>(in + 1, out, n - 1);
+    for (size_t i = 0; i + 1 < n; ++i) {
+        double expected[5];
+        legendre_all<4>(in[i + 1], expected);
+        EXPECT_NEAR(o0[i], expected[0], 1e-15);
+        EXPECT_NEAR(o4[i], expected[4], 1e-15);
+    }
+    float fin[n], f0[n], f1[n], f2[n];
+    float* fout[3] = {f0, f1, f2};
+    for (size_t i = 0; i < n; ++i) {
+        fin[i] = static_cast<float>(in[i]);
+    }
+    laguerre_all_n<2>(fin, fout, n);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_NEAR(f2[i], laguerre<2>::eval(fin[i]), 1e-6F);
+    }
+}
+
+TEST(known_polynomials, chebyshev_approximation) {
+    // exp on [-1, 1] : degree 14 reaches double precision, taylor needs degree 17
+    constexpr auto f = [](auto x) { return aerobus::exp<i64, 20>::eval(x); };
+    using E = chebyshev_approximation<decltype(f), make_q64_t<-1, 1>, make_q64_t<1, 1>, 14>;
+    using E10 = chebyshev_approximation<decltype(f), make_q64_t<-1, 1>, make_q64_t<1, 1>, 10>;
+    using T10 = aerobus::exp<i64, 10>;
+    double worst_cheb = 0.0, worst_taylor = 0.0;
+    for (int i = -100; i <= 100; ++i) {
+        const double x = 0.01 * i;
+        EXPECT_NEAR(E::eval(x), std::exp(x), 4 * std::numeric_limits<double>::epsilon() * std::exp(x));
+        worst_cheb = std::max(worst_cheb, std::fabs(E10::eval(x) - std::exp(x)));
+        worst_taylor = std::max(worst_taylor, std::fabs(T10::eval(x) - std::exp(x)));
+    }
+    EXPECT_LT(worst_cheb, 5e-11);
+    EXPECT_LT(1000 * worst_cheb, worst_taylor);
+
+    // sin on [0, 2], shifted interval, float and batched
+    constexpr auto g = [](auto x) { return aerobus::sin<i64, 19>::eval(x); };
+    using S = chebyshev_approximation<decltype(g), make_q64_t<0, 1>, make_q64_t<2, 1>, 9>;
+    constexpr double s1 = S::eval(1.0);
+    EXPECT_NEAR(s1, std::sin(1.0), 1e-9);
+    float in[67], out[67];
+    for (int i = 0; i < 67; ++i) {
+        in[i] = 2.0F * static_cast<float>(i) / 66.0F;
+    }
+    S::eval_n(in + 1, out + 1, 66);
+    for (int i = 1; i < 67; ++i) {
+        EXPECT_NEAR(out[i], std::sin(in[i]), 4e-7F);
+        EXPECT_NEAR(out[i], S::eval(in[i]), 2e-7F);
+    }
+}
+
 TEST(known_polynomials, bernoulli) {
     {
         using B1 = known_polynomials::bernoulli<1>;
@@ -1168,6 +1799,55 @@ TEST(embedding, polynomial) {
 //     EXPECT_EQ(aerobus::libm::exp2(2.0), 4.0);
 // }
 
+TEST(double_double, arithmetic) {
+    {
+        constexpr double_double x = double_double(1.0) + double_double(0x1p-60);
+        EXPECT_EQ(x.hi, 1.0);
+        EXPECT_EQ(x.lo, 0x1p-60);
+        EXPECT_EQ(static_cast<double>(x), 1.0);
+    }
+    {  // (1 + 2^-30)^2 = 1 + 2^-29 + 2^-60
+        constexpr double_double x = double_double(1.0 + 0x1p-30) * double_double(1.0 + 0x1p-30);
+        EXPECT_EQ(x.hi, 1.0 + 0x1p-29);
+        EXPECT_EQ(x.lo, 0x1p-60);
+        double a = 1.0 + 0x1p-30;
+        double_double y = double_double(a) * double_double(a);
+        EXPECT_EQ(y.hi, 1.0 + 0x1p-29);
+        EXPECT_EQ(y.lo, 0x1p-60);
+    }
+    {
+        double_double third = double_double(1.0) / double_double(3.0);
+        double_double one = third * double_double(3.0);
+        EXPECT_EQ(one.hi, 1.0);
+        EXPECT_LE(std::fabs(one.lo), 0x1p-104);
+        double_double zero = third + third + third - double_double(1.0);
+        EXPECT_LE(std::fabs(zero.hi), 0x1p-104);
+    }
+    {
+        constexpr double_double a(1.0, 0x1p-60);
+        constexpr double_double b(1.0);
+        EXPECT_TRUE(b < a);
+        EXPECT_TRUE(a > b);
+        EXPECT_TRUE(b <= a);
+        EXPECT_TRUE(a != b);
+        EXPECT_TRUE(-a < -b);
+        EXPECT_FALSE(a < a);
+        EXPECT_TRUE(a == a);
+    }
+    {
+        using constants = aerobus::arithmetic_helpers<double_double>;
+        EXPECT_EQ(meta_libm<double_double>::floor(double_double(2.5)).hi, 2.0);
+        EXPECT_EQ(meta_libm<double_double>::floor(double_double(-2.5)).hi, -3.0);
+        double_double f = meta_libm<double_double>::floor(double_double(0x1p60, -0.5));
+        EXPECT_EQ(f.hi, 0x1p60);
+        EXPECT_EQ(f.lo, -1.0);
+        // 10 - 2pi
+        double_double r = meta_libm<double_double>::fmod(double_double(10.0), constants::two_pi());
+        EXPECT_EQ(r.hi, 0x1.dbc095777a5cfp1);  // round(10 - 2*pi, D, RN)
+        EXPECT_EQ(meta_libm<double_double>::fmod(double_double(-10.0), constants::two_pi()).hi, -r.hi);
+    }
+}
+
 TEST(libm, sin_reduction) {
     using d_constants = aerobus::arithmetic_helpers<double>;
     using f_constants = aerobus::arithmetic_helpers<float>;
@@ -1289,6 +1969,586 @@ TEST(libm, sin) {
     }
 }
 
+TEST(libm, sin_cos_double) {
+    using constants = aerobus::arithmetic_helpers<double>;
+    double values[] = {
+        1E-9,
+        -1E-9,
+        0.1,
+        0.863769531250000,
+        constants::pi() / 8,
+        3 * constants::pi() / 8,
+        3 * constants::pi() / 4,
+        3 * constants::pi() / 2,
+        constants::pi_2(),
+        constants::two_pi(),
+        9 * constants::pi() / 8,
+        2.0,
+        10.0,
+        -1.0,
+        -6.05078125,
+        100.0,
+        776.0,
+    };
+
+    for (double x : values) {
+        double s = aerobus::libm::sin(x);
+        double expected = std::sin(x);
+        EXPECT_LE(std::fabs(s - expected), 2 * ulp(expected)) << std::hexfloat << "sin(" << x << ")";
+        double c = aerobus::libm::cos(x);
+        expected = std::cos(x);
+        EXPECT_LE(std::fabs(c - expected), 2 * ulp(expected)) << std::hexfloat << "cos(" << x << ")";
+    }
+
+    EXPECT_TRUE(std::isnan(aerobus::libm::sin(std::numeric_limits<double>::infinity())));
+    EXPECT_TRUE(std::isnan(aerobus::libm::cos(std::numeric_limits<double>::quiet_NaN())));
+    EXPECT_EQ(aerobus::libm::cos(0.0), 1.0);
+    EXPECT_EQ(aerobus::libm::sin(-0.0), -0.0);
+}
+
+TEST(libm, sin_cos_near_multiples_of_pi) {
+    // reduction cancels most bits of x there : pi must be known far beyond 106 bits
+    constexpr long double pio2 = 1.570796326794896619231321691639751442L;
+    for (int64_t k = 1; k < (1 << 20); k = k * 3 / 2 + 1) {
+        const double xk = static_cast<double>(static_cast<long double>(k) * pio2);
+        for (double x : { std::nextafter(xk, 0.0), xk, std::nextafter(xk, 1e300) }) {
+            const double s = static_cast<double>(sinl(static_cast<long double>(x)));
+            const double c = static_cast<double>(cosl(static_cast<long double>(x)));
+            EXPECT_LE(std::fabs(aerobus::libm::sin(x) - s), ulp(s)) << std::hexfloat << "sin(" << x << ")";
+            EXPECT_LE(std::fabs(aerobus::libm::cos(x) - c), ulp(c)) << std::hexfloat << "cos(" << x << ")";
+        }
+        if (k < (1 << 12)) {
+            const float xf = static_cast<float>(xk);
+            const float s = static_cast<float>(std::sin(static_cast<double>(xf)));
+            const float c = static_cast<float>(std::cos(static_cast<double>(xf)));
+            EXPECT_LE(std::fabs(aerobus::libm::sin(xf) - s), ulp(s)) << std::hexfloat << "sin(" << xf << ")";
+            EXPECT_LE(std::fabs(aerobus::libm::cos(xf) - c), ulp(c)) << std::hexfloat << "cos(" << xf << ")";
+        }
+    }
+    for (double x : { 0x1.102fbd5a41b84p+18, 0x1.fcdc4c9a14136p+19 }) {
+        const double s = static_cast<double>(sinl(static_cast<long double>(x)));
+        const double c = static_cast<double>(cosl(static_cast<long double>(x)));
+        EXPECT_LE(std::fabs(aerobus::libm::sin(x) - s), ulp(s)) << std::hexfloat << "sin(" << x << ")";
+        EXPECT_LE(std::fabs(aerobus::libm::cos(x) - c), ulp(c)) << std::hexfloat << "cos(" << x << ")";
+    }
+    const float s = static_cast<float>(std::sin(0x1.f9cbe2p+11));
+    EXPECT_LE(std::fabs(aerobus::libm::sin(0x1.f9cbe2p+11F) - s), ulp(s));
+}
+
+TEST(libm, sin_cos_n_near_multiples_of_pi) {
+    constexpr long double pio2 = 1.570796326794896619231321691639751442L;
+    std::vector<double> din, dsin, dcos;
+    std::vector<float> fin, fsin, fcos;
+    for (int64_t k = 1; k < (1 << 20); k = k * 3 / 2 + 1) {
+        const double xk = static_cast<double>(static_cast<long double>(k) * pio2);
+        for (double x : { std::nextafter(xk, 0.0), xk, std::nextafter(xk, 1e300) }) {
+            din.push_back(x);
+            din.push_back(-x);
+        }
+        const float xf = static_cast<float>(xk);
+        for (float x : { std::nextafter(xf, 0.0F), xf, std::nextafter(xf, 1e30F) }) {
+            fin.push_back(x);
+            fin.push_back(-x);
+        }
+    }
+    dsin.resize(din.size());
+    dcos.resize(din.size());
+    fsin.resize(fin.size());
+    fcos.resize(fin.size());
+    aerobus::libm::sin_n(din.data(), dsin.data(), din.size());
+    aerobus::libm::cos_n(din.data(), dcos.data(), din.size());
+    aerobus::libm::sin_n(fin.data(), fsin.data(), fin.size());
+    aerobus::libm::cos_n(fin.data(), fcos.data(), fin.size());
+    for (size_t i = 0; i < din.size(); ++i) {
+        const double s = static_cast<double>(sinl(static_cast<long double>(din[i])));
+        const double c = static_cast<double>(cosl(static_cast<long double>(din[i])));
+        EXPECT_LE(std::fabs(dsin[i] - s), ulp(s)) << std::hexfloat << "sin(" << din[i] << ")";
+        EXPECT_LE(std::fabs(dcos[i] - c), ulp(c)) << std::hexfloat << "cos(" << din[i] << ")";
+    }
+    for (size_t i = 0; i < fin.size(); ++i) {
+        const float s = static_cast<float>(std::sin(static_cast<double>(fin[i])));
+        const float c = static_cast<float>(std::cos(static_cast<double>(fin[i])));
+        EXPECT_LE(std::fabs(fsin[i] - s), ulp(s)) << std::hexfloat << "sin(" << fin[i] << ")";
+        EXPECT_LE(std::fabs(fcos[i] - c), ulp(c)) << std::hexfloat << "cos(" << fin[i] << ")";
+    }
+}
+
+TEST(libm, fast_sin_cos_n) {
+    constexpr size_t n = 517;
+    double din[n], dsin[n], dcos[n];
+    float fin[n], fsin[n], fcos[n];
+    for (size_t i = 0; i < n; ++i) {
+        din[i] = -0x1.921fb54442d18p-1 + static_cast<double>(i) * 0x1.921fb54442d18p0 / (n - 1);
+        fin[i] = static_cast<float>(din[i]);
+    }
+    aerobus::libm::fast_sin_n(din, dsin, n);
+    aerobus::libm::fast_cos_n(din, dcos, n);
+    aerobus::libm::fast_sin_n(fin + 1, fsin + 1, n - 1);
+    aerobus::libm::fast_cos_n(fin + 1, fcos + 1, n - 1);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_NEAR(dsin[i], std::sin(din[i]), 2 * std::numeric_limits<double>::epsilon());
+        EXPECT_NEAR(dcos[i], std::cos(din[i]), 2 * std::numeric_limits<double>::epsilon());
+        EXPECT_NEAR(aerobus::libm::fast_sin(din[i]), std::sin(din[i]), 2 * std::numeric_limits<double>::epsilon());
+        if (i > 0) {
+            EXPECT_NEAR(fsin[i], std::sin(fin[i]), 2 * std::numeric_limits<float>::epsilon());
+            EXPECT_NEAR(fcos[i], std::cos(fin[i]), 2 * std::numeric_limits<float>::epsilon());
+        }
+    }
+}
+
+TEST(libm, sin_cos_n) {
+    constexpr size_t n = 1001;
+    std::vector<double> din(n), dsin(n), dcos(n);
+    std::vector<float> fin(n), fsin(n), fcos(n);
+    for (size_t i = 0; i < n; ++i) {
+        din[i] = -3000.0 + 6000.0 * static_cast<double>(i) / (n - 1) + 0.123;
+        fin[i] = static_cast<float>(din[i]);
+    }
+    // beyond cody-waite threshold : scalar fallback
+    din[3] = 2e6;
+    din[4] = -1e9;
+    din[5] = std::numeric_limits<double>::infinity();
+    din[6] = std::numeric_limits<double>::quiet_NaN();
+    fin[3] = 1e4F;
+    fin[4] = -std::numeric_limits<float>::infinity();
+    aerobus::libm::sin_n(din.data(), dsin.data(), n);
+    aerobus::libm::cos_n(din.data(), dcos.data(), n);
+    aerobus::libm::sin_n(fin.data() + 1, fsin.data() + 1, n - 1);
+    aerobus::libm::cos_n(fin.data() + 1, fcos.data() + 1, n - 1);
+    EXPECT_TRUE(std::isnan(dsin[5]) && std::isnan(dcos[5]));
+    EXPECT_TRUE(std::isnan(dsin[6]) && std::isnan(dcos[6]));
+    EXPECT_TRUE(std::isnan(fsin[4]) && std::isnan(fcos[4]));
+    EXPECT_EQ(dsin[3], aerobus::libm::sin(din[3]));
+    EXPECT_EQ(fcos[3], aerobus::libm::cos(fin[3]));
+    for (size_t i = 0; i < n; ++i) {
+        if (i < 3 || i > 6) {
+            double s = std::sin(din[i]), c = std::cos(din[i]);
+            EXPECT_LE(std::fabs(dsin[i] - s), 3 * ulp(s)) << std::hexfloat << "sin(" << din[i] << ")";
+            EXPECT_LE(std::fabs(dcos[i] - c), 3 * ulp(c)) << std::hexfloat << "cos(" << din[i] << ")";
+        }
+        if (i > 0 && (i < 3 || i > 4)) {
+            float s = static_cast<float>(std::sin(static_cast<double>(fin[i])));
+            float c = static_cast<float>(std::cos(static_cast<double>(fin[i])));
+            EXPECT_LE(std::fabs(fsin[i] - s), 3 * ulp(s)) << std::hexfloat << "sin(" << fin[i] << ")";
+            EXPECT_LE(std::fabs(fcos[i] - c), 3 * ulp(c)) << std::hexfloat << "cos(" << fin[i] << ")";
+        }
+    }
+}
+
+TEST(libm, payne_hanek) {
+    // computed with 500 digits of pi
+    constexpr uint32_t expected[40] = {
+        0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0, 0xdb629599, 0x3c439041, 0xfe5163ab, 0xdebbc561,
+        0xb7246e3a, 0x424dd2e0, 0x06492eea, 0x09d1921c, 0xfe1deb1c, 0xb129a73e, 0xe88235f5, 0x2ebb4484,
+        0xe99c7026, 0xb45f7e41, 0x3991d639, 0x835339f4, 0x9c845f8b, 0xbdf9283b, 0x1ff897ff, 0xde05980f,
+        0xef2f118b, 0x5a0a6d1f, 0x6d367ecf, 0x27cb09b7, 0x4f463f66, 0x9e5fea2d, 0x7527bac7, 0xebe5f17b,
+        0x3d0739f7, 0x8a5292ea, 0x6bfb5fb1, 0x1f8d5d08, 0x56033046, 0xfc7b6bab, 0xf0cfbc20, 0x9af4361d,
+    };
+    for (size_t i = 0; i < 40; ++i) {
+        EXPECT_EQ(aerobus::libm::internal::two_over_pi_bits[i], expected[i]) << "limb " << i;
+    }
+
+    double values[] = {
+        0x1p20 + 1.0, 1e6 + 0.5, 1e9, 123456789.125, 1e22, 0x1.6ac5b262ca1ffp+849, 1e300,
+        std::numeric_limits<double>::max(), -1e15,
+    };
+    for (double x : values) {
+        double s = static_cast<double>(sinl(static_cast<long double>(x)));
+        double c = static_cast<double>(cosl(static_cast<long double>(x)));
+        EXPECT_LE(std::fabs(aerobus::libm::sin(x) - s), 2 * ulp(s)) << std::hexfloat << "sin(" << x << ")";
+        EXPECT_LE(std::fabs(aerobus::libm::cos(x) - c), 2 * ulp(c)) << std::hexfloat << "cos(" << x << ")";
+    }
+    double out[9];
+    aerobus::libm::sin_n(values, out, 9);
+    for (size_t i = 0; i < 9; ++i) {
+        EXPECT_EQ(out[i], aerobus::libm::sin(values[i]));
+    }
+
+    float fvalues[] = { 4476.7F, 1e5F, 1e6F, 1e20F, std::numeric_limits<float>::max(), -3e9F };
+    for (float x : fvalues) {
+        float s = static_cast<float>(std::sin(static_cast<double>(x)));
+        float c = static_cast<float>(std::cos(static_cast<double>(x)));
+        EXPECT_LE(std::fabs(aerobus::libm::sin(x) - s), 2 * ulp(s)) << std::hexfloat << "sin(" << x << ")";
+        EXPECT_LE(std::fabs(aerobus::libm::cos(x) - c), 2 * ulp(c)) << std::hexfloat << "cos(" << x << ")";
+    }
+}
+
+template<typename FT>
+bool within_ulp(FT x, FT expected, int count) {
+    return x == expected || std::fabs(x - expected) <= count * ulp(expected);
+}
+
+TEST(libm, exp) {
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    // overflow, underflow and denormals
+    EXPECT_EQ(aerobus::libm::exp(0.0), 1.0);
+    EXPECT_EQ(aerobus::libm::exp(710.0), inf);
+    EXPECT_EQ(aerobus::libm::exp(-746.0), 0.0);
+    EXPECT_EQ(aerobus::libm::exp(inf), inf);
+    EXPECT_EQ(aerobus::libm::exp(-inf), 0.0);
+    EXPECT_EQ(aerobus::libm::exp2(1024.0), inf);
+    EXPECT_EQ(aerobus::libm::exp2(-1074.0), std::numeric_limits<double>::denorm_min());
+    EXPECT_EQ(aerobus::libm::exp2(-1030.5), std::exp2(-1030.5));
+    EXPECT_EQ(aerobus::libm::exp2(3.0F), 8.0F);
+    EXPECT_EQ(aerobus::libm::exp2(-149.0F), std::numeric_limits<float>::denorm_min());
+    EXPECT_EQ(aerobus::libm::exp(89.0F), std::numeric_limits<float>::infinity());
+    EXPECT_EQ(aerobus::libm::expm1(-inf), -1.0);
+    EXPECT_EQ(aerobus::libm::expm1(inf), inf);
+    EXPECT_EQ(aerobus::libm::expm1(1e-310), 1e-310);
+    EXPECT_TRUE(std::signbit(aerobus::libm::expm1(-0.0)));
+    EXPECT_TRUE(std::isnan(aerobus::libm::exp(std::numeric_limits<double>::quiet_NaN())));
+    EXPECT_TRUE(std::isnan(aerobus::libm::exp2(std::numeric_limits<float>::quiet_NaN())));
+    EXPECT_TRUE(std::isnan(aerobus::libm::expm1(std::numeric_limits<double>::quiet_NaN())));
+
+    for (double x = -745.0; x < 709.0; x += 0.731) {
+        double e = std::exp(x), e2 = std::exp2(x), em = std::expm1(x);
+        EXPECT_TRUE(within_ulp(aerobus::libm::exp(x), e, 2)) << std::hexfloat << "exp(" << x << ")";
+        EXPECT_TRUE(within_ulp(aerobus::libm::exp2(x), e2, 2)) << std::hexfloat << "exp2(" << x << ")";
+        EXPECT_TRUE(within_ulp(aerobus::libm::expm1(x), em, 4)) << std::hexfloat << "expm1(" << x << ")";
+    }
+    for (double x = -1e-3; x < 1e-3; x += 1.37e-6) {
+        double em = std::expm1(x);
+        EXPECT_TRUE(within_ulp(aerobus::libm::expm1(x), em, 4)) << std::hexfloat << "expm1(" << x << ")";
+    }
+}
+
+TEST(libm, exp_n) {
+    constexpr size_t n = 1001;
+    std::vector<double> din(n), dexp(n), dexp2(n), dexpm1(n);
+    std::vector<float> fin(n), fexp(n), fexp2(n), fexpm1(n);
+    for (size_t i = 0; i < n; ++i) {
+        din[i] = -100.0 + 200.0 * static_cast<double>(i) / (n - 1) + 0.123;
+        fin[i] = static_cast<float>(din[i]);
+    }
+    din[3] = std::numeric_limits<double>::quiet_NaN();
+    din[4] = 800.0;
+    fin[3] = -std::numeric_limits<float>::infinity();
+    aerobus::libm::exp_n(din.data(), dexp.data(), n);
+    aerobus::libm::exp2_n(din.data(), dexp2.data(), n);
+    aerobus::libm::expm1_n(din.data(), dexpm1.data(), n);
+    aerobus::libm::exp_n(fin.data() + 1, fexp.data() + 1, n - 1);
+    aerobus::libm::exp2_n(fin.data() + 1, fexp2.data() + 1, n - 1);
+    aerobus::libm::expm1_n(fin.data() + 1, fexpm1.data() + 1, n - 1);
+    EXPECT_TRUE(std::isnan(dexp[3]) && std::isnan(dexp2[3]) && std::isnan(dexpm1[3]));
+    EXPECT_EQ(dexp[4], std::numeric_limits<double>::infinity());
+    EXPECT_EQ(fexp[3], 0.0F);
+    EXPECT_EQ(fexpm1[3], -1.0F);
+    for (size_t i = 0; i < n; ++i) {
+        if (i != 3) {
+            EXPECT_EQ(dexp[i], aerobus::libm::exp(din[i])) << std::hexfloat << "exp(" << din[i] << ")";
+        }
+        if (i > 4) {
+            double e = std::exp(din[i]), e2 = std::exp2(din[i]), em = std::expm1(din[i]);
+            EXPECT_TRUE(within_ulp(dexp[i], e, 2)) << std::hexfloat << "exp(" << din[i] << ")";
+            EXPECT_TRUE(within_ulp(dexp2[i], e2, 2)) << std::hexfloat << "exp2(" << din[i] << ")";
+            EXPECT_TRUE(within_ulp(dexpm1[i], em, 4)) << std::hexfloat << "expm1(" << din[i] << ")";
+            float fe = static_cast<float>(std::exp(static_cast<double>(fin[i])));
+            float fe2 = static_cast<float>(std::exp2(static_cast<double>(fin[i])));
+            float fem = static_cast<float>(std::expm1(static_cast<double>(fin[i])));
+            EXPECT_TRUE(within_ulp(fexp[i], fe, 2)) << std::hexfloat << "exp(" << fin[i] << ")";
+            EXPECT_TRUE(within_ulp(fexp2[i], fe2, 2)) << std::hexfloat << "exp2(" << fin[i] << ")";
+            EXPECT_TRUE(within_ulp(fexpm1[i], fem, 4)) << std::hexfloat << "expm1(" << fin[i] << ")";
+        }
+    }
+}
+
+TEST(libm, log) {
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    EXPECT_EQ(aerobus::libm::log(1.0), 0.0);
+    EXPECT_EQ(aerobus::libm::log(0.0), -inf);
+    EXPECT_EQ(aerobus::libm::log(-0.0), -inf);
+    EXPECT_EQ(aerobus::libm::log(inf), inf);
+    EXPECT_TRUE(std::isnan(aerobus::libm::log(-1.0)));
+    EXPECT_TRUE(std::isnan(aerobus::libm::log(std::numeric_limits<double>::quiet_NaN())));
+    EXPECT_EQ(aerobus::libm::log2(0x1p-1074), -1074.0);
+    EXPECT_EQ(aerobus::libm::log2(0x1p-149F), -149.0F);
+    EXPECT_EQ(aerobus::libm::log2(1024.0F), 10.0F);
+    EXPECT_EQ(aerobus::libm::log1p(-1.0), -inf);
+    EXPECT_EQ(aerobus::libm::log1p(1e-310), 1e-310);
+    EXPECT_TRUE(std::signbit(aerobus::libm::log1p(-0.0)));
+    EXPECT_TRUE(std::isnan(aerobus::libm::log1p(-2.0F)));
+
+    for (double p = -1074.0; p < 1024.0; p += 0.377) {
+        double x = std::exp2(p);
+        double l = std::log(x), l2 = std::log2(x), l1 = std::log1p(x);
+        EXPECT_TRUE(within_ulp(aerobus::libm::log(x), l, 1)) << std::hexfloat << "log(" << x << ")";
+        EXPECT_TRUE(within_ulp(aerobus::libm::log2(x), l2, 2)) << std::hexfloat << "log2(" << x << ")";
+        EXPECT_TRUE(within_ulp(aerobus::libm::log1p(x), l1, 1)) << std::hexfloat << "log1p(" << x << ")";
+        if (x < 2.0) {
+            EXPECT_TRUE(within_ulp(aerobus::libm::log1p(-x / 2), std::log1p(-x / 2), 1))
+                << std::hexfloat << "log1p(" << -x / 2 << ")";
+        }
+    }
+}
+
+TEST(libm, log_n) {
+    constexpr size_t n = 1001;
+    std::vector<double> din(n), dlog(n), dlog2(n), dlog1p(n);
+    std::vector<float> fin(n), flog(n), flog2(n), flog1p(n);
+    for (size_t i = 0; i < n; ++i) {
+        din[i] = std::exp2(-140.0 + 260.0 * static_cast<double>(i) / (n - 1));
+        fin[i] = static_cast<float>(din[i]);
+    }
+    din[3] = std::numeric_limits<double>::quiet_NaN();
+    din[4] = -1.0;
+    fin[3] = 0.0F;
+    aerobus::libm::log_n(din.data(), dlog.data(), n);
+    aerobus::libm::log2_n(din.data(), dlog2.data(), n);
+    aerobus::libm::log1p_n(din.data(), dlog1p.data(), n);
+    aerobus::libm::log_n(fin.data() + 1, flog.data() + 1, n - 1);
+    aerobus::libm::log2_n(fin.data() + 1, flog2.data() + 1, n - 1);
+    aerobus::libm::log1p_n(fin.data() + 1, flog1p.data() + 1, n - 1);
+    EXPECT_TRUE(std::isnan(dlog[3]) && std::isnan(dlog2[3]) && std::isnan(dlog1p[3]));
+    EXPECT_TRUE(std::isnan(dlog[4]) && std::isnan(dlog2[4]));
+    EXPECT_EQ(dlog1p[4], -std::numeric_limits<double>::infinity());
+    EXPECT_EQ(flog[3], -std::numeric_limits<float>::infinity());
+    EXPECT_EQ(flog1p[3], 0.0F);
+    for (size_t i = 0; i < n; ++i) {
+        if (i != 3 && i != 4) {
+            EXPECT_TRUE(within_ulp(dlog[i], aerobus::libm::log(din[i]), 1)) << std::hexfloat << "log(" << din[i] << ")";
+        }
+        if (i > 4) {
+            double l = std::log(din[i]), l2 = std::log2(din[i]), l1 = std::log1p(din[i]);
+            EXPECT_TRUE(within_ulp(dlog[i], l, 1)) << std::hexfloat << "log(" << din[i] << ")";
+            EXPECT_TRUE(within_ulp(dlog2[i], l2, 2)) << std::hexfloat << "log2(" << din[i] << ")";
+            EXPECT_TRUE(within_ulp(dlog1p[i], l1, 1)) << std::hexfloat << "log1p(" << din[i] << ")";
+            float fl = static_cast<float>(std::log(static_cast<double>(fin[i])));
+            float fl2 = static_cast<float>(std::log2(static_cast<double>(fin[i])));
+            float fl1 = static_cast<float>(std::log1p(static_cast<double>(fin[i])));
+            EXPECT_TRUE(within_ulp(flog[i], fl, 1)) << std::hexfloat << "log(" << fin[i] << ")";
+            EXPECT_TRUE(within_ulp(flog2[i], fl2, 2)) << std::hexfloat << "log2(" << fin[i] << ")";
+            EXPECT_TRUE(within_ulp(flog1p[i], fl1, 1)) << std::hexfloat << "log1p(" << fin[i] << ")";
+        }
+    }
+}
+
+TEST(libm, sincos) {
+    using constants = aerobus::arithmetic_helpers<double>;
+    double values[] = {
+        0.0, 1e-300, -0.5, constants::pi_4(), 3 * constants::pi_4(), constants::pi(), 3 * constants::pi_2(),
+        -10.0, 776.0, 1e6, -3e9, 1e300,
+    };
+    for (double x : values) {
+        double s, c;
+        aerobus::libm::sincos(x, &s, &c);
+        EXPECT_TRUE(within_ulp(s, std::sin(x), 2)) << std::hexfloat << "sin(" << x << ")";
+        EXPECT_TRUE(within_ulp(c, std::cos(x), 2)) << std::hexfloat << "cos(" << x << ")";
+        // same reduction as sin
+        EXPECT_EQ(s, aerobus::libm::sin(x)) << std::hexfloat << "sin(" << x << ")";
+    }
+    float fs, fc;
+    aerobus::libm::sincos(std::numeric_limits<float>::infinity(), &fs, &fc);
+    EXPECT_TRUE(std::isnan(fs) && std::isnan(fc));
+    aerobus::libm::sincos(10.0F, &fs, &fc);
+    EXPECT_TRUE(within_ulp(fs, static_cast<float>(std::sin(10.0)), 1));
+    EXPECT_TRUE(within_ulp(fc, static_cast<float>(std::cos(10.0)), 1));
+
+    constexpr size_t n = 1001;
+    std::vector<double> din(n), dsin(n), dcos(n), dsin_ref(n), dcos_ref(n);
+    for (size_t i = 0; i < n; ++i) {
+        din[i] = -3000.0 + 6000.0 * static_cast<double>(i) / (n - 1) + 0.123;
+    }
+    din[3] = 2e6;
+    din[4] = std::numeric_limits<double>::infinity();
+    aerobus::libm::sincos_n(din.data() + 1, dsin.data() + 1, dcos.data() + 1, n - 1);
+    aerobus::libm::sin_n(din.data() + 1, dsin_ref.data() + 1, n - 1);
+    aerobus::libm::cos_n(din.data() + 1, dcos_ref.data() + 1, n - 1);
+    EXPECT_TRUE(std::isnan(dsin[4]) && std::isnan(dcos[4]));
+    for (size_t i = 1; i < n; ++i) {
+        if (i != 4) {
+            EXPECT_EQ(dsin[i], dsin_ref[i]) << std::hexfloat << "sin(" << din[i] << ")";
+            EXPECT_EQ(dcos[i], dcos_ref[i]) << std::hexfloat << "cos(" << din[i] << ")";
+        }
+    }
+}
+
+template<typename T>
+void check_sin_cos_at_pi() {
+    const T values[] = { aerobus::arithmetic_helpers<T>::pi(), -aerobus::arithmetic_helpers<T>::pi() };
+    for (T x : values) {
+        T s, c;
+        aerobus::libm::sincos(x, &s, &c);
+        EXPECT_TRUE(within_ulp(aerobus::libm::sin(x), std::sin(x), 1)) << std::hexfloat << "sin(" << x << ")";
+        EXPECT_TRUE(within_ulp(aerobus::libm::cos(x), std::cos(x), 1)) << std::hexfloat << "cos(" << x << ")";
+        EXPECT_TRUE(within_ulp(s, std::sin(x), 1)) << std::hexfloat << "sincos(" << x << ")";
+        EXPECT_TRUE(within_ulp(c, std::cos(x), 1)) << std::hexfloat << "sincos(" << x << ")";
+    }
+}
+
+TEST(libm, sin_cos_at_pi) {
+    check_sin_cos_at_pi<float>();
+    check_sin_cos_at_pi<double>();
+}
+
+TEST(libm, accuracy_tiers) {
+    using aerobus::libm::accuracy::ulp4;
+    using aerobus::libm::accuracy::approx_1e4;
+    double values[] = { 0.0, 1e-300, -0.5, 0.75, 2.0, -10.0, 776.0, 1e5 };
+    for (double x : values) {
+        const double s4 = aerobus::libm::sin<double, ulp4>(x), c4 = aerobus::libm::cos<double, ulp4>(x);
+        const double sa = aerobus::libm::sin<double, approx_1e4>(x), ca = aerobus::libm::cos<double, approx_1e4>(x);
+        EXPECT_TRUE(within_ulp(s4, std::sin(x), 4)) << std::hexfloat << "sin(" << x << ")";
+        EXPECT_TRUE(within_ulp(c4, std::cos(x), 4)) << std::hexfloat << "cos(" << x << ")";
+        EXPECT_NEAR(sa, std::sin(x), 1E-4) << std::hexfloat << "sin(" << x << ")";
+        EXPECT_NEAR(ca, std::cos(x), 1E-4) << std::hexfloat << "cos(" << x << ")";
+        double s, c;
+        aerobus::libm::sincos<double, ulp4>(x, &s, &c);
+        EXPECT_EQ(s, s4);
+        EXPECT_EQ(c, c4);
+    }
+    // ulp4 keeps special cases
+    const double s_inf = aerobus::libm::sin<double, ulp4>(std::numeric_limits<double>::infinity());
+    const double s_huge = aerobus::libm::sin<double, ulp4>(1e300);
+    EXPECT_TRUE(std::isnan(s_inf));
+    EXPECT_TRUE(within_ulp(s_huge, std::sin(1e300), 4));
+    const float fs = aerobus::libm::fast_sin<float, approx_1e4>(0.7F);
+    const float fc = aerobus::libm::fast_cos<float, approx_1e4>(0.7F);
+    EXPECT_NEAR(fs, std::sin(0.7F), 1E-4F);
+    EXPECT_NEAR(fc, std::cos(0.7F), 1E-4F);
+
+    constexpr size_t n = 1001;
+    std::vector<float> in(n), s1(n), s4(n), sa(n), ca(n);
+    for (size_t i = 0; i < n; ++i) {
+        in[i] = static_cast<float>(-1000.0 + 2000.0 * static_cast<double>(i) / (n - 1) + 0.123);
+    }
+    aerobus::libm::sin_n(in.data(), s1.data(), n);
+    aerobus::libm::sin_n<float, ulp4>(in.data(), s4.data(), n);
+    aerobus::libm::sincos_n<float, approx_1e4>(in.data(), sa.data(), ca.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        const double x = static_cast<double>(in[i]);
+        EXPECT_TRUE(within_ulp(s1[i], static_cast<float>(std::sin(x)), 1)) << std::hexfloat << "sin(" << in[i] << ")";
+        EXPECT_TRUE(within_ulp(s4[i], static_cast<float>(std::sin(x)), 4)) << std::hexfloat << "sin(" << in[i] << ")";
+        EXPECT_NEAR(sa[i], std::sin(x), 1E-4) << std::hexfloat << "sin(" << in[i] << ")";
+        EXPECT_NEAR(ca[i], std::cos(x), 1E-4) << std::hexfloat << "cos(" << in[i] << ")";
+    }
+}
+
+TEST(libm, atan_atan2) {
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    constexpr double pi = 0x1.921fb54442d18p+1;
+    double values[] = { 0.0, -0.0, 1e-310, 0.3, -0.5, 1.0, 2.5, -7.0, 1e10, -1e300, inf, -inf };
+    for (double x : values) {
+        EXPECT_TRUE(within_ulp(aerobus::libm::atan(x), std::atan(x), 2)) << std::hexfloat << "atan(" << x << ")";
+        for (double y : values) {
+            EXPECT_TRUE(within_ulp(aerobus::libm::atan2(y, x), std::atan2(y, x), 2))
+                << std::hexfloat << "atan2(" << y << ", " << x << ")";
+        }
+    }
+    // C99 special cases
+    EXPECT_EQ(aerobus::libm::atan2(0.0, -0.0), pi);
+    EXPECT_EQ(aerobus::libm::atan2(-0.0, -0.0), -pi);
+    EXPECT_TRUE(std::signbit(aerobus::libm::atan2(-0.0, 1.0)));
+    EXPECT_EQ(aerobus::libm::atan2(-inf, -inf), -3 * pi / 4);
+    EXPECT_TRUE(std::isnan(aerobus::libm::atan2(std::nan(""), 1.0)));
+    EXPECT_TRUE(std::isnan(aerobus::libm::atan2(1.0, std::nan(""))));
+    EXPECT_TRUE(within_ulp(aerobus::libm::atan2(-3.0F, -4.0F), static_cast<float>(std::atan2(-3.0, -4.0)), 2));
+
+    constexpr size_t n = 1001;
+    std::vector<double> dy(n), dx(n), datan(n), datan2(n);
+    std::vector<float> fin(n), fatan(n);
+    for (size_t i = 0; i < n; ++i) {
+        dx[i] = -50.0 + 100.0 * static_cast<double>(i) / (n - 1) + 0.017;
+        dy[i] = std::sin(static_cast<double>(i)) * 3.0;
+        fin[i] = static_cast<float>(dx[i]);
+    }
+    dx[3] = std::numeric_limits<double>::quiet_NaN();
+    aerobus::libm::atan_n(dx.data() + 1, datan.data() + 1, n - 1);
+    aerobus::libm::atan2_n(dy.data() + 1, dx.data() + 1, datan2.data() + 1, n - 1);
+    aerobus::libm::atan_n(fin.data(), fatan.data(), n);
+    EXPECT_TRUE(std::isnan(datan[3]) && std::isnan(datan2[3]));
+    for (size_t i = 1; i < n; ++i) {
+        if (i != 3) {
+            EXPECT_TRUE(within_ulp(datan[i], std::atan(dx[i]), 2)) << std::hexfloat << "atan(" << dx[i] << ")";
+            EXPECT_TRUE(within_ulp(datan2[i], std::atan2(dy[i], dx[i]), 2))
+                << std::hexfloat << "atan2(" << dy[i] << ", " << dx[i] << ")";
+            float fa = static_cast<float>(std::atan(static_cast<double>(fin[i])));
+            EXPECT_TRUE(within_ulp(fatan[i], fa, 2)) << std::hexfloat << "atan(" << fin[i] << ")";
+        }
+    }
+}
+
+TEST(libm, asin_acos) {
+    double values[] = { 0.0, -0.0, 1e-310, 0.25, -0.5, 0.5000001, 0.9, -0.999999, 1.0, -1.0 };
+    for (double x : values) {
+        EXPECT_TRUE(within_ulp(aerobus::libm::asin(x), std::asin(x), 2)) << std::hexfloat << "asin(" << x << ")";
+        EXPECT_TRUE(within_ulp(aerobus::libm::acos(x), std::acos(x), 2)) << std::hexfloat << "acos(" << x << ")";
+    }
+    EXPECT_TRUE(std::signbit(aerobus::libm::asin(-0.0)));
+    EXPECT_EQ(aerobus::libm::acos(1.0), 0.0);
+    EXPECT_TRUE(std::isnan(aerobus::libm::asin(1.5)) && std::isnan(aerobus::libm::acos(-1.5)));
+    EXPECT_TRUE(std::isnan(aerobus::libm::asin(std::numeric_limits<double>::infinity())));
+    EXPECT_TRUE(std::isnan(aerobus::libm::acos(std::numeric_limits<float>::quiet_NaN())));
+
+    constexpr size_t n = 1001;
+    std::vector<double> din(n), dasin(n), dacos(n);
+    std::vector<float> fin(n), fasin(n), facos(n);
+    for (size_t i = 0; i < n; ++i) {
+        din[i] = -1.0 + 2.0 * static_cast<double>(i) / (n - 1);
+        fin[i] = static_cast<float>(din[i]);
+    }
+    aerobus::libm::asin_n(din.data() + 1, dasin.data() + 1, n - 1);
+    aerobus::libm::acos_n(din.data() + 1, dacos.data() + 1, n - 1);
+    aerobus::libm::asin_n(fin.data(), fasin.data(), n);
+    aerobus::libm::acos_n(fin.data(), facos.data(), n);
+    for (size_t i = 1; i < n; ++i) {
+        EXPECT_TRUE(within_ulp(dasin[i], std::asin(din[i]), 2)) << std::hexfloat << "asin(" << din[i] << ")";
+        EXPECT_TRUE(within_ulp(dacos[i], std::acos(din[i]), 2)) << std::hexfloat << "acos(" << din[i] << ")";
+        float fs = static_cast<float>(std::asin(static_cast<double>(fin[i])));
+        float fc = static_cast<float>(std::acos(static_cast<double>(fin[i])));
+        EXPECT_TRUE(within_ulp(fasin[i], fs, 3)) << std::hexfloat << "asin(" << fin[i] << ")";
+        EXPECT_TRUE(within_ulp(facos[i], fc, 2)) << std::hexfloat << "acos(" << fin[i] << ")";
+    }
+}
+
+TEST(libm, polynomial_tables) {
+    // the tables of log, atan and asin are remez_t of these series, truncated beyond long double precision
+    // log : (2 atanh(s)/s - 2) / s^2 = sum 2 u^(k-1) / (2k+1) with u = s^2
+    constexpr auto log_f = [](long double u) {
+        long double acc = 0.0L, p = 1.0L;
+        for (int k = 1; k < 14; ++k) {
+            acc += 2.0L * p / (2 * k + 1);
+            p *= u;
+        }
+        return acc;
+    };
+    // atan : (atan(t)/t - 1) / t^2 = sum (-1)^k u^(k-1) / (2k+1) with u = t^2
+    constexpr auto atan_f = [](long double u) {
+        long double acc = 0.0L, p = -1.0L;
+        for (int k = 1; k < 28; ++k) {
+            acc += p / (2 * k + 1);
+            p *= -u;
+        }
+        return acc;
+    };
+    // asin : (asin(s)/s - 1) / s^2 = sum binomial(2k, k) / 4^k u^(k-1) / (2k+1) with u = s^2
+    constexpr auto asin_f = [](long double u) {
+        long double acc = 0.0L, c = 0.5L, p = 1.0L;
+        for (int k = 1; k < 34; ++k) {
+            acc += c * p / (2 * k + 1);
+            c *= (2.0L * k + 1) / (2.0L * k + 2);
+            p *= u;
+        }
+        return acc;
+    };
+    using zero = make_q64_t<0, 1>;
+    using log_b = make_q64_t<295, 10000>;
+    // tan(pi/8)^2 = 3 - 2 sqrt(2)
+    using atan_b = make_q64_t<171572875253809903, 1000000000000000000>;
+    using asin_b = make_q64_t<1, 4>;
+    EXPECT_TRUE((std::is_same_v<libm::internal::log_poly<double>::type,
+                                remez_t<q64, decltype(log_f), zero, log_b, 6>>));
+    EXPECT_TRUE((std::is_same_v<libm::internal::log_poly<float>::type,
+                                remez_t<q32, decltype(log_f), zero, log_b, 2>>));
+    EXPECT_TRUE((std::is_same_v<libm::internal::atan_poly<double>::type,
+                                remez_t<q64, decltype(atan_f), zero, atan_b, 10>>));
+    EXPECT_TRUE((std::is_same_v<libm::internal::atan_poly<float>::type,
+                                remez_t<q32, decltype(atan_f), zero, atan_b, 4>>));
+    EXPECT_TRUE((std::is_same_v<libm::internal::asin_poly<double>::type,
+                                remez_t<q64, decltype(asin_f), zero, asin_b, 12>>));
+    EXPECT_TRUE((std::is_same_v<libm::internal::asin_poly<float>::type,
+                                remez_t<q32, decltype(asin_f), zero, asin_b, 4>>));
+}
+
 TEST(libm, cos) {
     using constants = aerobus::arithmetic_helpers<float>;
     float values[] = {